@@ -2,7 +2,9 @@
 
 #include "Components/ControlAim.h"
 #include "Components/OrbitFollow.h"
+#include "Core/ECameraAimAssistSubsystem.h"
 #include "Utils/ECameraLibrary.h"
+#include "Utils/ECameraLookInputProcessor.h"
 #include "Utils/ECameraTypes.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
@@ -28,11 +30,15 @@ UControlAim::UControlAim()
 	HorizontalDamping = FVector2f(0.2f, 0.2f);
 	VerticalDamping = FVector2f(0.2f, 0.2f);
 	bSyncToController = false;
+	bSubFrameInput = false;
 
 	CachedMouseDeltaX = 0.0f;
 	CachedMouseDeltaY = 0.0f;
+	LookRate = FVector2D(0, 0);
+	LookInputTime = 0.0;
 	WaitElaspedTime = 0.0f;
 	bInAimAssist = false;
+	LateIntegratedFrame = MAX_uint64;
 	OffsetInAimAssist = FVector();
 }
 
@@ -43,27 +49,82 @@ void UControlAim::ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserveS
 
 void UControlAim::UpdateComponent_Implementation(float DeltaTime)
 {
+	/** This frame's input was already applied by late update, right before view setup. */
+	if (LateIntegratedFrame != GFrameCounter)
+	{
+		GetMouseDelta();
+
+		/** Resolve recentering. */
+		if (ResolveRecentering(DeltaTime))
+		{
+			CachedMouseDeltaX = 0;
+			CachedMouseDeltaY = 0;
+			LookRate = FVector2D(0, 0);
+			LookInputTime = 0.0;
+			return;
+		}
+
+		ApplyLookInput(DeltaTime);
+	}
+
+	/** Check if there exists an actor that will be in aim assist. */
+	bInAimAssist = CheckAimAssist();
+
+	/** Sync with Controller. */
+	if (bSyncToController)
+	{
+		GetOwningSettingComponent()->GetPlayerController()->SetControlRotation(GetOwningActor()->GetActorRotation());
+	}
+}
+
+void UControlAim::LateUpdateComponent(float DeltaTime)
+{
+	/** Aim assist pulls toward an actor picked in the regular tick, so leave those frames to it. */
+	if (bInAimAssist || LateIntegratedFrame == GFrameCounter) return;
+
+	/** Input was processed before camera manager runs, so this is the input of the frame being viewed. */
 	GetMouseDelta();
-	
-	/** Resolve recentering. */
-	if (ResolveRecentering(DeltaTime))
+
+	/** Without input, recentering may take over. It is resolved in the regular tick. */
+	if (RecenteringParams.bRecentering)
 	{
-		CachedMouseDeltaX = 0;
-		CachedMouseDeltaY = 0;
-		return;
+		if (RawMouseDeltaX == 0 && RawMouseDeltaY == 0) return;
+		WaitElaspedTime = 0;
 	}
 
+	/** Mark before applying, so the regular tick later in this frame does not apply the same input again. */
+	LateIntegratedFrame = GFrameCounter;
+	ApplyLookInput(DeltaTime);
+
+	if (bSyncToController)
+	{
+		GetOwningSettingComponent()->GetPlayerController()->SetControlRotation(GetOwningActor()->GetActorRotation());
+	}
+}
+
+void UControlAim::ApplyLookInput(float DeltaTime)
+{
 	/** Apply speed multiplier. */
 	RawMouseDeltaX = RawMouseDeltaX * HorizontalSpeed;
 	RawMouseDeltaY = RawMouseDeltaY * VerticalSpeed;
 
-	/** Damp, constrain and set camera yaw. */
-	float ResultDeltaX = CachedMouseDeltaX + GetDampedMouseDelta(RawMouseDeltaX, true, DeltaTime);
+	/** Damp camera yaw and pitch. */
+	float ResultDeltaX, ResultDeltaY;
+	if (bSubFrameInput)
+	{
+		IntegrateSubFrameInput(RawMouseDeltaX, RawMouseDeltaY, DeltaTime, ResultDeltaX, ResultDeltaY);
+	}
+	else
+	{
+		ResultDeltaX = CachedMouseDeltaX + GetDampedMouseDelta(RawMouseDeltaX, true, DeltaTime);
+		ResultDeltaY = CachedMouseDeltaY + GetDampedMouseDelta(RawMouseDeltaY, false, DeltaTime);
+	}
+
+	/** Constrain camera yaw. */
 	float WrapYaw = ConstrainYaw(ResultDeltaX);
 	ResultDeltaX += WrapYaw;
 
-	/** Damp, constrain and set camera pitch. */
-	float ResultDeltaY = CachedMouseDeltaY + GetDampedMouseDelta(RawMouseDeltaY, false, DeltaTime);
+	/** Constrain camera pitch. */
 	ConstrainPitch(ResultDeltaY);
 	
 	/** If not in aim assist. */
@@ -97,15 +158,6 @@ void UControlAim::UpdateComponent_Implementation(float DeltaTime)
 	/** Update cached delta. */
 	CachedMouseDeltaX = ResultDeltaX;
 	CachedMouseDeltaY = ResultDeltaY;
-
-	/** Check if there exists an actor that will be in aim assist. */
-	bInAimAssist = CheckAimAssist();
-
-	/** Sync with Controller. */
-	if (bSyncToController)
-	{
-		GetOwningSettingComponent()->GetPlayerController()->SetControlRotation(GetOwningActor()->GetActorRotation());
-	}
 }
 
 void UControlAim::GetMouseDelta()
@@ -151,6 +203,85 @@ float UControlAim::GetDampedMouseDelta(const float& MouseDelta, bool bIsHorizont
 	return Output;
 }
 
+void UControlAim::IntegrateSubFrameInput(float MouseDeltaX, float MouseDeltaY, float DeltaTime, float& OutDeltaX, float& OutDeltaY)
+{
+	TSharedPtr<FECameraLookInputProcessor> LookInputProcessor = FECameraLookInputProcessor::Get();
+	const double EndTime = LookInputProcessor.IsValid() ? LookInputProcessor->GetLatestTime() : FPlatformTime::Seconds();
+
+	/** Restart from one frame ago after a gap, e.g., when becoming view target again or after a hitch. */
+	double StartTime = LookInputTime;
+	if (StartTime <= 0.0 || EndTime - StartTime > 0.25 || EndTime <= StartTime) StartTime = EndTime - DeltaTime;
+	LookInputTime = EndTime;
+
+	TArray<FECameraLookInputSample, TMemStackAllocator<>> Samples;
+	if (LookInputProcessor.IsValid()) LookInputProcessor->GetSamples(StartTime, EndTime, Samples);
+
+	/** Raw samples only give timing. Scale them so that they sum to this frame's input on each axis. */
+	FVector2D SampleSum = FVector2D(0, 0);
+	for (const FECameraLookInputSample& Sample : Samples) SampleSum += Sample.Delta;
+
+	auto BuildSegments = [&](float MouseDelta, double SampleAxisSum, bool bIsHorizontal, TArray<FVector2D, TMemStackAllocator<>>& OutSegments)
+	{
+		/** Fall back to spreading input over the whole frame if samples do not agree with input, e.g., for gamepads. */
+		if (MouseDelta == 0 || FMath::Abs(SampleAxisSum) <= UE_KINDA_SMALL_NUMBER || SampleAxisSum * MouseDelta < 0)
+		{
+			OutSegments.Add(FVector2D(EndTime - StartTime, MouseDelta));
+			return;
+		}
+
+		const double Scale = MouseDelta / SampleAxisSum;
+		double SegmentStart = StartTime;
+		for (const FECameraLookInputSample& Sample : Samples)
+		{
+			OutSegments.Add(FVector2D(Sample.Time - SegmentStart, (bIsHorizontal ? Sample.Delta.X : Sample.Delta.Y) * Scale));
+			SegmentStart = Sample.Time;
+		}
+		if (SegmentStart < EndTime) OutSegments.Add(FVector2D(EndTime - SegmentStart, 0));
+	};
+
+	TArray<FVector2D, TMemStackAllocator<>> Segments;
+	BuildSegments(MouseDeltaX, SampleSum.X, true, Segments);
+	OutDeltaX = IntegrateLookAxis(LookRate.X, Segments, HorizontalDamping);
+
+	Segments.Reset();
+	BuildSegments(MouseDeltaY, SampleSum.Y, false, Segments);
+	OutDeltaY = IntegrateLookAxis(LookRate.Y, Segments, VerticalDamping);
+}
+
+float UControlAim::IntegrateLookAxis(double& Rate, TArrayView<const FVector2D> Segments, const FVector2f& Damping)
+{
+	/** Same exponential decay as the naive damper, but applied to look rate in closed form over each segment. */
+	const double LnResidual = FMath::Loge(FDampParams().Residual);
+
+	double Output = 0;
+	for (const FVector2D& Segment : Segments)
+	{
+		const double Duration = Segment.X;
+		const double Delta = Segment.Y;
+		if (Duration <= UE_SMALL_NUMBER)
+		{
+			Output += Delta;
+			continue;
+		}
+
+		const double TargetRate = Delta / Duration;
+		const float DampTime = FMath::Abs(TargetRate) < FMath::Abs(Rate) ? Damping.Y : Damping.X;
+		if (DampTime <= 0)
+		{
+			Rate = TargetRate;
+			Output += Delta;
+			continue;
+		}
+
+		/** Rate decays towards target rate, and output is its exact integral over the segment. */
+		const double Lambda = -LnResidual / DampTime;
+		const double Decay = FMath::Exp(-Lambda * Duration);
+		Output += TargetRate * Duration + (Rate - TargetRate) * (1.0 - Decay) / Lambda;
+		Rate = TargetRate + (Rate - TargetRate) * Decay;
+	}
+	return Output;
+}
+
 bool UControlAim::ResolveRecentering(const float& DeltaTime)
 {
 	if (RecenteringParams.bRecentering)
@@ -278,35 +409,59 @@ void UControlAim::ConstrainPitch(float& ResultDeltaY)
 	if (CameraRotation.Pitch + ResultDeltaY < VerticalRange.X) ResultDeltaY = VerticalRange.X - CameraRotation.Pitch;
 }
 
-/** @TODO: This function might be too time-consuming? Need improvement. */
 bool UControlAim::CheckAimAssist()
 {
-	if (AimAssist.bEnableAimAssist)
+	UECameraAimAssistSubsystem* AimAssistSubsystem = GetWorld()->GetSubsystem<UECameraAimAssistSubsystem>();
+	if (AimAssist.bEnableAimAssist && AimAssistSubsystem != nullptr)
 	{
-		float ClosestDistance = 99999;
-		for (const FOffsetActorType& OffsetTargetType : AimAssist.TargetTypes)
+		/** Camera has been rotated in this tick, so build the frame once here and reuse it for all candidates. */
+		const FECameraFrame Frame = UECameraLibrary::MakeCameraFrame(GetOwningActor());
+
+		/** Only iterate registered candidates, skipping those tracked for other cameras' target types. */
+		TBitArray<> RelevantTypes;
+		AimAssistSubsystem->GetRelevantTypes(AimAssist.TargetTypes, RelevantTypes);
+		AimAssistSubsystem->PruneCandidates();
+
+		/** Only candidates in front within MaxDistance and within MagneticRadius of view axis can engage aim assist. */
+		TArray<int32, TMemStackAllocator<>> CandidateIndices;
+		AimAssistSubsystem->QueryCylinder(Frame.Position, Frame.Forward, AimAssist.MaxDistance, AimAssist.MagneticRadius, CandidateIndices);
+
+		/** Gather relevant candidates' cached positions contiguously, then score them in one batch. */
+		TArrayView<const int32> Types = AimAssistSubsystem->GetCandidateTypes();
+		TArrayView<const double> CandidatePositionsX = AimAssistSubsystem->GetCandidatePositionsX();
+		TArrayView<const double> CandidatePositionsY = AimAssistSubsystem->GetCandidatePositionsY();
+		TArrayView<const double> CandidatePositionsZ = AimAssistSubsystem->GetCandidatePositionsZ();
+
+		TArray<int32, TMemStackAllocator<>> GatheredIndices;
+		TArray<double, TMemStackAllocator<>> PositionsX, PositionsY, PositionsZ;
+		GatheredIndices.Reserve(CandidateIndices.Num());
+		PositionsX.Reserve(CandidateIndices.Num());
+		PositionsY.Reserve(CandidateIndices.Num());
+		PositionsZ.Reserve(CandidateIndices.Num());
+		for (int32 Index : CandidateIndices)
 		{
-			TArray<AActor*> OutActors;
-			UGameplayStatics::GetAllActorsOfClass(GetWorld(), OffsetTargetType.ActorType, OutActors);
-			for (AActor* TargetActor : OutActors)
-			{
-				FVector RealPosition = UECameraLibrary::GetPositionWithLocalOffset(TargetActor, OffsetTargetType.Offset);
-				FVector LocalSpacePosition = UECameraLibrary::GetLocalSpacePosition(GetOwningActor(), RealPosition);
-
-				if (LocalSpacePosition.X > 0 && LocalSpacePosition.X <= AimAssist.MaxDistance)
-				{
-					LocalSpacePosition.X = 0;
-					float Distance = LocalSpacePosition.Length();
-					if (Distance < ClosestDistance)
-					{
-						ClosestDistance = Distance;
-						ScreenDistanceInAimAssist = Distance;
-						ActorInAimAssist = TargetActor;
-						OffsetInAimAssist = OffsetTargetType.Offset;
-					}
-				}
-			}
+			if (Types[Index] != INDEX_NONE && !RelevantTypes[Types[Index]]) continue;
+			GatheredIndices.Add(Index);
+			PositionsX.Add(CandidatePositionsX[Index]);
+			PositionsY.Add(CandidatePositionsY[Index]);
+			PositionsZ.Add(CandidatePositionsZ[Index]);
+		}
+
+		float ScreenDistance = 0.0f;
+		const int32 BestIndex = UECameraLibrary::FindClosestAimAssistCandidate(Frame, PositionsX, PositionsY, PositionsZ, AimAssist.MaxDistance, ScreenDistance);
+
+		/** Candidates may all be culled or rejected, so do not keep last frame's result. */
+		if (BestIndex == INDEX_NONE)
+		{
+			ActorInAimAssist = nullptr;
+			return false;
 		}
+
+		const int32 CandidateIndex = GatheredIndices[BestIndex];
+		ScreenDistanceInAimAssist = ScreenDistance;
+		ActorInAimAssist = AimAssistSubsystem->GetCandidateActors()[CandidateIndex].Get();
+		OffsetInAimAssist = AimAssistSubsystem->GetCandidateOffsets()[CandidateIndex];
+
 		if (ScreenDistanceInAimAssist <= AimAssist.MagneticRadius)
 		{
 			return true;
@@ -9,6 +9,10 @@ UCraneFollow::UCraneFollow()
 	Stage = EStage::Follow;
 
 	bLockOrientationOutwards = false;
+	bRigless = false;
+	CraneBase = FTransform::Identity;
+	ArmLengthRange = FVector2f(0, 100000);
+	PitchRange = FVector2f(-180, 180);
 	FollowType = ECraneFollowType::FollowTarget;
 	FollowOffset = FVector(0, 0, 0);
 	bLockArmLength = false;
@@ -24,12 +28,13 @@ UCraneFollow::UCraneFollow()
 	CurrentKeyPoint = -1;
 	ElapsedBlendTime = 0;
 	ElapsedDurationTime = 0;
+	CraneState = FVector(0, 0, 0);
 }
 
 void UCraneFollow::UpdateComponent_Implementation(float DeltaTime)
 {
-	/** If crane is null, return. */
-	if (Crane == nullptr) return;
+	/** If crane is null and crane is not rigless, return. */
+	if (!bRigless && Crane == nullptr) return;
 
 	/** If camera is currently blueprinted. */
 	if (bIsBlueprinting)
@@ -44,27 +49,25 @@ void UCraneFollow::UpdateComponent_Implementation(float DeltaTime)
 		if (!bHasBegun)
 		{
 			bHasBegun = true;
-			Crane->CraneArmLength = StartPosition.X;
-			Crane->CraneYaw = StartPosition.Y;
-			Crane->CranePitch = StartPosition.Z;
+			SetCraneState(StartPosition);
 		}
 
 		/** Respectively for arm length, crane yaw and crane pitch. */
+		FVector NewCraneState = GetCraneState();
 		for (int index = 0; index < 3; ++index)
 		{
 			if (ElapsedTime > Duration[index] && Duration[index] != 0.0f) continue;
 			
-			if (index == 0) Crane->CraneArmLength += Speed[0] * DeltaTime;
-			if (index == 1) Crane->CraneYaw += Speed[1] * DeltaTime;
-			if (index == 2) Crane->CranePitch += Speed[2] * DeltaTime;
+			NewCraneState[index] += Speed[index] * DeltaTime;
 		}
+		SetCraneState(NewCraneState);
 
 		/** Set new location and rotation. */
 		UpdateAndSetTransform();
 		ElapsedTime += DeltaTime;
 
 		/** Update variables for HUD. */
-		CraneLocation = Crane->GetActorLocation();
+		CraneLocation = GetCraneBase().GetLocation();
 	}
 	else if (FollowType == ECraneFollowType::FollowTarget)
 	{
@@ -74,13 +77,11 @@ void UCraneFollow::UpdateComponent_Implementation(float DeltaTime)
 		if (!bHasBegun)
 		{
 			bHasBegun = true;
-			Crane->CraneArmLength = StartPosition.X;
-			Crane->CraneYaw = StartPosition.Y;
-			Crane->CranePitch = StartPosition.Z;
+			SetCraneState(StartPosition);
 		}
 
 		/** Apply follow offset, in world space. */
-		FVector FollowPosition = FollowTarget->GetActorLocation() + FollowOffset;
+		FVector FollowPosition = GetTargetKinematics(FollowTarget.Get()).Position + FollowOffset;
 
 		/** Set new crane position. */
 		SetPositionToFollow(FollowPosition, DeltaTime);
@@ -93,9 +94,7 @@ void UCraneFollow::UpdateComponent_Implementation(float DeltaTime)
 		/** Start position. */
 		if (CurrentKeyPoint == -1)
 		{
-			Crane->CraneArmLength = ManualKeyPoints.StartPosition.X;
-			Crane->CraneYaw = ManualKeyPoints.StartPosition.Y;
-			Crane->CranePitch = ManualKeyPoints.StartPosition.Z;
+			SetCraneState(ManualKeyPoints.StartPosition);
 			UpdateAndSetTransform();
 			if (ManualKeyPoints.KeyPoints.Num() > 0) CurrentKeyPoint = 0;
 		}
@@ -143,23 +142,61 @@ void UCraneFollow::UpdateComponent_Implementation(float DeltaTime)
 				float DeltaPitch = UKismetMathLibrary::Ease(0, MoveAmount[2], ElapsedBlendTime / ManualKeyPoints.KeyPoints[CurrentKeyPoint].BlendTime, ManualKeyPoints.KeyPoints[CurrentKeyPoint].BlendFunc);
 
 				/** Apply deltas. */
-				Crane->CraneArmLength = Start[0] + DeltaArmLength;
-				Crane->CraneYaw = Start[1] + DeltaYaw;
-				Crane->CranePitch = Start[2] + DeltaPitch;
+				SetCraneState(FVector(Start[0] + DeltaArmLength, Start[1] + DeltaYaw, Start[2] + DeltaPitch));
 				UpdateAndSetTransform();
 			}
 		}
 	}
 }
 
+void UCraneFollow::ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserveState)
+{
+	/** Take over the rig, so that it neither needs to be written to nor ticked at runtime. */
+	if (bRigless && Crane != nullptr)
+	{
+		CraneBase = FTransform(Crane->GetActorQuat(), Crane->GetActorLocation());
+		CraneState = FVector(Crane->CraneArmLength, Crane->CraneYaw, Crane->CranePitch);
+		Crane->SetActorTickEnabled(false);
+	}
+}
+
+FVector UCraneFollow::GetCraneState() const
+{
+	if (bRigless) return CraneState;
+	return FVector(Crane->CraneArmLength, Crane->CraneYaw, Crane->CranePitch);
+}
+
+void UCraneFollow::SetCraneState(const FVector& InCraneState)
+{
+	if (bRigless)
+	{
+		CraneState.X = FMath::Clamp(InCraneState.X, ArmLengthRange.X, ArmLengthRange.Y);
+		CraneState.Y = InCraneState.Y;
+		CraneState.Z = FMath::Clamp(InCraneState.Z, PitchRange.X, PitchRange.Y);
+	}
+	else
+	{
+		Crane->CraneArmLength = InCraneState.X;
+		Crane->CraneYaw = InCraneState.Y;
+		Crane->CranePitch = InCraneState.Z;
+	}
+}
+
+FTransform UCraneFollow::GetCraneBase() const
+{
+	if (bRigless) return CraneBase;
+	/** Crane rig's yaw and pitch are in world space, regardless of the rig's own rotation. */
+	return FTransform(Crane->GetActorLocation());
+}
+
 FTransform UCraneFollow::UpdateTransformOnCrane()
 {
-	FRotator NewYawControlRot = FRotator(0.f, Crane->CraneYaw, 0.f);
-	FRotator NewPitchControlRot = FRotator(Crane->CranePitch, 0.f, 0.f);
+	const FVector State = GetCraneState();
+	const FTransform Base = GetCraneBase();
 
-	FQuat NewQuat = NewYawControlRot.Quaternion() * NewPitchControlRot.Quaternion();
-	FVector LocationOffset = UKismetMathLibrary::GetForwardVector(NewQuat.Rotator()) * Crane->CraneArmLength;
-	FVector NewLocation = LocationOffset + Crane->GetActorLocation();
+	/** Yaw then pitch, in closed form. Arm points along the resulting forward axis. */
+	FQuat NewQuat = Base.GetRotation() * FRotator(State.Z, State.Y, 0.f).Quaternion();
+	FVector NewLocation = Base.GetLocation() + NewQuat.GetForwardVector() * State.X;
 
 	return FTransform(NewQuat, NewLocation);
 }
@@ -174,16 +211,20 @@ void UCraneFollow::UpdateAndSetTransform()
 
 void UCraneFollow::SetPositionToFollow(const FVector& FollowPosition, float DeltaTime)
 {
-	/** Get desired arm length, crane yaw and crane pitch. */
-	float DesiredArmLength = UKismetMathLibrary::Vector_Distance(Crane->GetActorLocation(), FollowPosition);
-	FRotator DesiredRotation = UKismetMathLibrary::FindLookAtRotation(Crane->GetActorLocation(), FollowPosition);
+	/** Get desired arm length, crane yaw and crane pitch, relative to crane base. */
+	const FTransform Base = GetCraneBase();
+	FVector LocalFollowPosition = Base.GetRotation().UnrotateVector(FollowPosition - Base.GetLocation());
+	float DesiredArmLength = LocalFollowPosition.Size();
+	FRotator DesiredRotation = LocalFollowPosition.Rotation();
 	float DesiredYaw = DesiredRotation.Yaw;
 	float DesiredPitch = DesiredRotation.Pitch;
 
 	/** Apply damped delta. */
-	if (!bLockArmLength) Crane->CraneArmLength = DesiredArmLength;
-	if (!bLockYaw) Crane->CraneYaw = DesiredYaw;
-	if (!bLockPitch) Crane->CranePitch = DesiredPitch;
+	FVector NewCraneState = GetCraneState();
+	if (!bLockArmLength) NewCraneState.X = DesiredArmLength;
+	if (!bLockYaw) NewCraneState.Y = DesiredYaw;
+	if (!bLockPitch) NewCraneState.Z = DesiredPitch;
+	SetCraneState(NewCraneState);
 }
 
 void UCraneFollow::RenormalizeYawAndPitch(FVector& Input)
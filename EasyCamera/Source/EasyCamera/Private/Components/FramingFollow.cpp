@@ -20,6 +20,7 @@ UFramingFollow::UFramingFollow()
 	CameraDistance = 200.0f;
 	FollowOffset = FVector(0.0f, 0.0f, 0.0f);
 	DampParams = FDampParams();
+	Prediction = FPredictionParams();
 	FollowDamping = FVector(0.0f, 0.0f, 0.0f);
 	ScreenOffset = FVector2f(0.0f, 0.0f);
 	AdaptiveScreenOffsetDistanceX = FVector2f(200.0f, -100.0f);
@@ -28,13 +29,16 @@ UFramingFollow::UFramingFollow()
 	ScreenOffsetHeight = FVector2f(-0.1f, 0.1f);
 	PreviousLocation = FVector(0.0f, 0.0f, 0.0f);
 	ExactSpringVel = FVector(0.0f, 0.0f, 0.0f);
+	CachedFieldOfView = -1.0f;
+	TanHalfFOV = 0.0;
+	InvAspectRatio = 1.0;
 }
 
 void UFramingFollow::UpdateComponent_Implementation(float DeltaTime)
 {
 	if (FollowTarget != nullptr)
 	{
-		FVector FollowPosition = UECameraLibrary::GetPositionWithLocalOffset(FollowTarget.Get(), FollowOffset);
+		FVector FollowPosition = UECameraLibrary::GetPositionWithLocalOffset(FollowTarget.Get(), FollowOffset) + GetPredictedOffset(FollowTarget.Get(), Prediction);
 
 		/** Get real screen offset. */
 		FVector AimPosition = FVector(0, 0, 0);
@@ -48,8 +52,10 @@ void UFramingFollow::UpdateComponent_Implementation(float DeltaTime)
 		}
 		else RealScreenOffset = ScreenOffset;
 
-		/** Transform from world space to local space. */
-		FVector LocalSpaceFollowPosition = UECameraLibrary::GetLocalSpacePosition(GetOwningActor(), FollowPosition);
+		/** Transform from world space to local space once. Every delta below is solved against this frame. */
+		const FECameraFrame& Frame = GetCameraFrame();
+		FVector LocalSpaceFollowPosition = Frame.ToLocal(FollowPosition);
+		UpdateProjection();
 
 		/** Temporary (before damping) delta position. */
 		FVector TempDeltaPosition = FVector(0, 0, 0);
@@ -62,25 +68,24 @@ void UFramingFollow::UpdateComponent_Implementation(float DeltaTime)
 			AdaptiveCameraDistance = PitchDistanceCurve->GetFloatValue(Pitch);
 		}
 
-		/** First move the camera along the local space X axis. */
+		/** Solve and damp the forward delta first, since the screen space extent depends on the resulting depth. */
 		SetForwardDelta(LocalSpaceFollowPosition, TempDeltaPosition, AdaptiveCameraDistance);
+		const double DampedDeltaX = DampForwardDelta(TempDeltaPosition, DeltaTime);
+		TempDeltaPosition.X = 0;
 
-		/** Damp delta x and apply it. */
-		ApplyForwardDelta(TempDeltaPosition, DeltaTime);
-
-		/** Then move the camera along the local space YZ plane. */
-		/** First need to re-calculate local space position as we've altered camera X position. */
-		LocalSpaceFollowPosition = UECameraLibrary::GetLocalSpacePosition(GetOwningActor(), FollowPosition);
+		/** Moving along local X does not change local Y and Z, so only depth needs to be shifted. */
+		LocalSpaceFollowPosition.X -= DampedDeltaX;
 		SetYZPlaneDelta(LocalSpaceFollowPosition, TempDeltaPosition, RealScreenOffset);
 
-		/** Get damped delta position. */
+		/** Get damped and clamped delta position. */
 		FVector DampedDeltaPosition = DampDeltaPosition(LocalSpaceFollowPosition, TempDeltaPosition, DeltaTime, RealScreenOffset);
+		DampedDeltaPosition.X += DampedDeltaX;
 
 		/** Store current position. */
-		PreviousLocation = GetOwningActor()->GetActorLocation();
+		PreviousLocation = Frame.Position;
 
-		/** Apply damped delta position. */
-		GetOwningActor()->AddActorLocalOffset(DampedDeltaPosition);
+		/** Commit the whole delta with a single transform update. */
+		GetOwningActor()->SetActorLocation(Frame.ToWorld(DampedDeltaPosition));
 
 		/** Update variables for HUD. */
 		RealFollowPosition = FollowPosition;
@@ -109,41 +114,48 @@ float UFramingFollow::NormalizePitch(float Pitch)
 	return NormalizedPitch;
 }
 
+void UFramingFollow::UpdateProjection()
+{
+	const UCameraComponent* CameraComponent = OwningCamera->GetCameraComponent();
+	if (CameraComponent->FieldOfView != CachedFieldOfView)
+	{
+		CachedFieldOfView = CameraComponent->FieldOfView;
+		TanHalfFOV = FMath::Tan(FMath::DegreesToRadians(CachedFieldOfView * 0.5));
+	}
+	InvAspectRatio = CameraComponent->AspectRatio > UE_KINDA_SMALL_NUMBER ? 1.0 / CameraComponent->AspectRatio : 1.0;
+}
+
 void UFramingFollow::SetForwardDelta(const FVector& LocalSpaceFollowPosition, FVector& TempDeltaPosition, float RealCameraDistance)
 {
 	TempDeltaPosition.X = LocalSpaceFollowPosition.X - RealCameraDistance;
 }
 
-void UFramingFollow::ApplyForwardDelta(FVector& TempDeltaPosition, float DeltaTime)
+double UFramingFollow::DampForwardDelta(const FVector& TempDeltaPosition, float DeltaTime)
 {
+	double DampedDeltaX = 0.0;
 	if (DampParams.DampMethod == EDampMethod::Naive || DampParams.DampMethod == EDampMethod::Simulate)
 	{
-		double DampedDeltaX;
 		UECameraLibrary::DamperValue(DampParams, DeltaTime, TempDeltaPosition.X, FollowDamping.X, DampedDeltaX);
-		GetOwningActor()->AddActorLocalOffset(FVector(DampedDeltaX, 0, 0));
 	}
 	else if (DampParams.DampMethod == EDampMethod::ExactSpring)
 	{
 		double CurrentPos = 0.0;
 		double CurrentVel = ExactSpringVel[0];
 		double TargetPos = TempDeltaPosition.X;
-		double TargetVel = FollowTarget->GetVelocity()[0] / 1.1f;
-		double OutPos = 0.0;
+		double TargetVel = GetTargetKinematics(FollowTarget.Get()).Velocity[0] / 1.1f;
 		double& OutVel = ExactSpringVel[0];
 
-		UECameraLibrary::ExactSpringDamperValue(CurrentPos, CurrentVel, TargetPos, TargetVel, DampParams.DampRatio[0], DampParams.HalfLife[0], DeltaTime, OutPos, OutVel);
-		GetOwningActor()->AddActorLocalOffset(FVector(OutPos, 0, 0));
+		UECameraLibrary::ExactSpringDamperValue(CurrentPos, CurrentVel, TargetPos, TargetVel, DampParams.DampRatio[0], DampParams.HalfLife[0], DeltaTime, DampedDeltaX, OutVel);
 	}
-	
-	/** Reset delta x to avoid duplicate calculation. */
-	TempDeltaPosition.X = 0;
+
+	return DampedDeltaX;
 }
 
 void UFramingFollow::SetYZPlaneDelta(const FVector& LocalSpaceFollowPosition, FVector& TempDeltaPosition, const FVector2f& RealScreenOffset)
 {
-	float W = UKismetMathLibrary::DegTan(OwningCamera->GetCameraComponent()->FieldOfView / 2.0f) * LocalSpaceFollowPosition.X * 2.0f;
-	float ExpectedPositionY = W * RealScreenOffset.X;
-	float ExpectedPositionZ = W / OwningCamera->GetCameraComponent()->AspectRatio * RealScreenOffset.Y;
+	const double W = TanHalfFOV * LocalSpaceFollowPosition.X * 2.0;
+	const double ExpectedPositionY = W * RealScreenOffset.X;
+	const double ExpectedPositionZ = W * InvAspectRatio * RealScreenOffset.Y;
 
 	TempDeltaPosition.Y = LocalSpaceFollowPosition.Y - ExpectedPositionY;
 	TempDeltaPosition.Z = LocalSpaceFollowPosition.Z - ExpectedPositionZ;
@@ -155,7 +167,7 @@ FVector UFramingFollow::DampDeltaPosition(const FVector& LocalSpaceFollowPositio
 	if (DampParams.DampMethod == EDampMethod::Naive || DampParams.DampMethod == EDampMethod::Simulate) 
 		UECameraLibrary::DamperVectorWithDifferentDampTime(DampParams, DeltaTime, TempDeltaPosition, FollowDamping, DampedDeltaPosition);
 	else if (DampParams.DampMethod == EDampMethod::Spring)
-		UECameraLibrary::SpringDampVector(DampParams, DeltaTime, GetOwningActor()->GetActorLocation() - PreviousLocation, TempDeltaPosition, DampedDeltaPosition);
+		UECameraLibrary::SpringDampVector(DampParams, DeltaTime, GetCameraFrame().Position - PreviousLocation, TempDeltaPosition, DampedDeltaPosition);
 	else if (DampParams.DampMethod == EDampMethod::ExactSpring)
 	{
 		double CachedVelX = ExactSpringVel[0];
@@ -163,7 +175,7 @@ FVector UFramingFollow::DampDeltaPosition(const FVector& LocalSpaceFollowPositio
 		FVector CurrentPos = FVector(0, 0, 0);
 		FVector CurrentVel = ExactSpringVel;
 		FVector TargetPos = TempDeltaPosition;
-		const FVector TargetVel = FollowTarget->GetVelocity() / 1.1f;
+		const FVector TargetVel = GetTargetKinematics(FollowTarget.Get()).Velocity / 1.1f;
 		FVector OutPos = FVector(0, 0, 0);
 		FVector& OutVel = ExactSpringVel;
 
@@ -182,11 +194,12 @@ void UFramingFollow::EnsureWithinBounds(const FVector& LocalSpaceFollowPosition,
 {
 	FVector ResultLocalSpacePosition = LocalSpaceFollowPosition - DampedDeltaPosition;
 
-	float Width = UKismetMathLibrary::DegTan(OwningCamera->GetCameraComponent()->FieldOfView / 2.0f) * FMath::Abs(ResultLocalSpacePosition.X) * 2.0f;
-	float LeftBound = (RealScreenOffset.X + ScreenOffsetWidth.X) * Width;
-	float RightBound = (RealScreenOffset.X + ScreenOffsetWidth.Y) * Width;
-	float BottomBound = (RealScreenOffset.Y + ScreenOffsetHeight.X) * Width / OwningCamera->GetCameraComponent()->AspectRatio;
-	float TopBound = (RealScreenOffset.Y + ScreenOffsetHeight.Y) * Width / OwningCamera->GetCameraComponent()->AspectRatio;
+	const double Width = TanHalfFOV * FMath::Abs(ResultLocalSpacePosition.X) * 2.0;
+	const double Height = Width * InvAspectRatio;
+	const double LeftBound = (RealScreenOffset.X + ScreenOffsetWidth.X) * Width;
+	const double RightBound = (RealScreenOffset.X + ScreenOffsetWidth.Y) * Width;
+	const double BottomBound = (RealScreenOffset.Y + ScreenOffsetHeight.X) * Height;
+	const double TopBound = (RealScreenOffset.Y + ScreenOffsetHeight.Y) * Height;
 	
 	if (ResultLocalSpacePosition.Y < LeftBound)   DampedDeltaPosition.Y += ResultLocalSpacePosition.Y - LeftBound;
 	if (ResultLocalSpacePosition.Y > RightBound)  DampedDeltaPosition.Y += ResultLocalSpacePosition.Y - RightBound;
@@ -14,15 +14,35 @@ UHardLockAim::UHardLockAim()
 	bUseQuatDamping = true;
 	EulerDamping = FVector(0.0f, 0.0f, 0.0f);
 	QuatDamping = 1.0f;
+	bAttachToTarget = false;
+	AppliedDesiredQuat = FQuat::Identity;
+	AppliedFrame = 0;
+	bInheritingRotation = false;
 }
 
 void UHardLockAim::UpdateComponent_Implementation(float DeltaTime)
 {
 	if (AimTarget != nullptr)
 	{
+		/** Scene graph rotates camera with the target. Restoring the offset is a no-op unless later stages rotated camera in last tick. */
+		if (CanInheritRotation())
+		{
+			/** Checked on the component, since the follow stage resets it to absolute whenever it re-attaches. */
+			USceneComponent* RootComponent = GetOwningActor()->GetRootComponent();
+			if (RootComponent->IsUsingAbsoluteRotation()) RootComponent->SetUsingAbsoluteRotation(false);
+			bInheritingRotation = true;
+			GetOwningActor()->SetActorRelativeRotation(RotationOffset);
+			return;
+		}
+		else if (bInheritingRotation) StopInheritingRotation();
+
 		/** Get desired rotation and quaternion. */
 		FQuat CurrentQuat = GetOwningActor()->GetActorQuat();
+		/** Read directly rather than through the target subsystem, for the same reason as HardLockFollow::GetFollowPosition. */
 		FQuat DesiredQuat = AimTarget->GetActorQuat() * FQuat(RotationOffset);
+		AppliedDesiredQuat = DesiredQuat;
+		AppliedFrame = GFrameCounter;
+		AppliedTarget = AimTarget.Get();
 		FRotator CurrentRotation = CurrentQuat.Rotator();
 		FRotator DesiredRotation = DesiredQuat.Rotator();
 
@@ -42,4 +62,56 @@ void UHardLockAim::UpdateComponent_Implementation(float DeltaTime)
 			GetOwningActor()->AddActorWorldRotation(DampedDeltaRotation);
 		}
 	}
+}
+
+void UHardLockAim::LateUpdateComponent(float DeltaTime)
+{
+	/** A damped camera intentionally lags behind, so only patch rotation when it is locked to the target.
+	 *  Camera manager runs before TG_PostUpdateWork, so the pose being viewed was applied by last frame's update.
+	 *  Only patch that update, and only for the same target. Otherwise the delta would include a target switch or a stale rotation.
+	 */
+	if (AimTarget != nullptr && IsUndamped() && !bInheritingRotation && AppliedFrame + 1 == GFrameCounter && AppliedTarget == TObjectKey<AActor>(AimTarget.Get()))
+	{
+		FQuat DesiredQuat = AimTarget->GetActorQuat() * FQuat(RotationOffset);
+		/** Apply the target's rotation change since update, preserving rotation added by later stages. */
+		GetOwningActor()->SetActorRotation(DesiredQuat * AppliedDesiredQuat.Inverse() * GetOwningActor()->GetActorQuat());
+		AppliedDesiredQuat = DesiredQuat;
+	}
+}
+
+bool UHardLockAim::IsUndamped() const
+{
+	if (bUseQuatDamping) return QuatDamping <= 0.0f;
+	return EulerDamping.X <= 0.0f && EulerDamping.Y <= 0.0f && EulerDamping.Z <= 0.0f;
+}
+
+void UHardLockAim::ResetOnEndViewTarget(APlayerController* PC)
+{
+	if (bInheritingRotation) StopInheritingRotation();
+}
+
+bool UHardLockAim::CanInheritRotation()
+{
+	USceneComponent* RootComponent = GetOwningActor()->GetRootComponent();
+	if (!bAttachToTarget || !IsUndamped() || RootComponent == nullptr || AimTarget == nullptr) return false;
+
+	/** A socket or child component rotates differently from the target itself, which RotationOffset is relative to. */
+	return RootComponent->GetAttachParent() != nullptr && RootComponent->GetAttachParent() == AimTarget->GetRootComponent() && RootComponent->GetAttachSocketName() == NAME_None;
+}
+
+void UHardLockAim::StopInheritingRotation()
+{
+	bInheritingRotation = false;
+
+	USceneComponent* RootComponent = GetOwningActor()->GetRootComponent();
+	if (RootComponent == nullptr) return;
+
+	/** Rotation stays absolute while still attached, so that only location follows the attach parent. */
+	const bool bStillAttached = GetOwningActor()->GetAttachParentActor() != nullptr;
+	if (RootComponent->IsUsingAbsoluteRotation() != bStillAttached)
+	{
+		const FQuat WorldQuat = GetOwningActor()->GetActorQuat();
+		RootComponent->SetUsingAbsoluteRotation(bStillAttached);
+		GetOwningActor()->SetActorRotation(WorldQuat);
+	}
 }
\ No newline at end of file
@@ -3,18 +3,131 @@
 #include "Components/HardLockFollow.h"
 #include "Utils/ECameraTypes.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
 
 UHardLockFollow::UHardLockFollow()
 {
 	Stage = EStage::Follow;
 	FollowOffset = FVector(0.0f, 0.0f, 0.0f);
+	bAttachToTarget = false;
+	AttachSocketName = NAME_None;
+	AppliedFollowPosition = FVector(0.0f, 0.0f, 0.0f);
+	AppliedFrame = 0;
+	AttachedSocketName = NAME_None;
+	bAttached = false;
 }
 
 void UHardLockFollow::UpdateComponent_Implementation(float DeltaTime)
 {
 	if (FollowTarget != nullptr)
 	{
-		FVector FollowPosition = FollowTarget->GetActorLocation() + UKismetMathLibrary::GreaterGreater_VectorRotator(FollowOffset, FollowTarget->GetActorRotation());
-		GetOwningActor()->SetActorLocation(FollowPosition);
+		if (bAttachToTarget)
+		{
+			/** Only resolve the attach parent again when target or socket changes. */
+			if (!IsAttachedToTarget() || AttachParent->GetOwner() != FollowTarget.Get() || AttachedSocketName != AttachSocketName)
+			{
+				AttachToTarget();
+			}
+
+			/** Scene graph moves camera with the target. Restoring the offset is a no-op unless later stages moved camera in last tick. */
+			if (IsAttachedToTarget())
+			{
+				GetOwningActor()->SetActorRelativeLocation(GetAttachedRelativeLocation());
+				return;
+			}
+		}
+		else if (bAttached) DetachFromTarget();
+
+		AppliedFollowPosition = GetFollowPosition();
+		AppliedFrame = GFrameCounter;
+		AppliedTarget = FollowTarget.Get();
+		GetOwningActor()->SetActorLocation(AppliedFollowPosition);
 	}
+	else if (bAttached) DetachFromTarget();
+}
+
+void UHardLockFollow::LateUpdateComponent(float DeltaTime)
+{
+	/** Camera manager runs before TG_PostUpdateWork, so the pose being viewed was applied by last frame's update.
+	 *  Only patch that update, and only for the same target. Otherwise the delta would include a target switch or a stale position.
+	 */
+	if (FollowTarget != nullptr && !IsAttachedToTarget() && AppliedFrame + 1 == GFrameCounter && AppliedTarget == TObjectKey<AActor>(FollowTarget.Get()))
+	{
+		/** Only apply how far the target has moved since update, preserving offsets added by later stages such as extensions. */
+		FVector FollowPosition = GetFollowPosition();
+		GetOwningActor()->AddActorWorldOffset(FollowPosition - AppliedFollowPosition);
+		AppliedFollowPosition = FollowPosition;
+	}
+}
+
+FVector UHardLockFollow::GetFollowPosition() const
+{
+	/** Read directly rather than through the target subsystem. Its sample is taken once per frame on first query, possibly before the target
+	 *  finished moving, and late update needs the target's transform at view setup. A hard lock shows any such lag as jitter.
+	 */
+	return FollowTarget->GetActorLocation() + FollowTarget->GetActorQuat().RotateVector(FollowOffset);
+}
+
+void UHardLockFollow::ResetOnEndViewTarget(APlayerController* PC)
+{
+	if (bAttached) DetachFromTarget();
+}
+
+void UHardLockFollow::AttachToTarget()
+{
+	if (bAttached) DetachFromTarget();
+
+	AttachedSocketName = AttachSocketName;
+	USceneComponent* Parent = FollowTarget->GetRootComponent();
+	FName ParentSocketName = NAME_None;
+	if (AttachSocketName != NAME_None)
+	{
+		TInlineComponentArray<USceneComponent*> SceneComponents(FollowTarget.Get());
+		for (USceneComponent* SceneComponent : SceneComponents)
+		{
+			if (SceneComponent->DoesSocketExist(AttachSocketName))
+			{
+				Parent = SceneComponent;
+				ParentSocketName = AttachSocketName;
+				break;
+			}
+		}
+	}
+
+	USceneComponent* RootComponent = GetOwningActor()->GetRootComponent();
+	if (Parent == nullptr || RootComponent == nullptr) return;
+
+	/** Only location follows the target. Rotation is owned by the aim stage, and target's scale should not scale camera. Offset is compensated separately. */
+	RootComponent->SetUsingAbsoluteRotation(true);
+	RootComponent->SetUsingAbsoluteScale(true);
+	GetOwningActor()->AttachToComponent(Parent, FAttachmentTransformRules::KeepWorldTransform, ParentSocketName);
+
+	AttachParent = Parent;
+	bAttached = true;
+	GetOwningActor()->SetActorRelativeLocation(GetAttachedRelativeLocation());
+}
+
+FVector UHardLockFollow::GetAttachedRelativeLocation()
+{
+	/** Relative location is transformed by the parent's full transform, scale included, so divide scale out again. */
+	const USceneComponent* RootComponent = GetOwningActor()->GetRootComponent();
+	if (!AttachParent.IsValid() || RootComponent == nullptr) return FollowOffset;
+
+	const FVector ParentScale = AttachParent->GetSocketTransform(RootComponent->GetAttachSocketName()).GetScale3D();
+	return FollowOffset * FTransform::GetSafeScaleReciprocal(ParentScale);
+}
+
+void UHardLockFollow::DetachFromTarget()
+{
+	GetOwningActor()->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+
+	if (USceneComponent* RootComponent = GetOwningActor()->GetRootComponent())
+	{
+		RootComponent->SetUsingAbsoluteRotation(false);
+		RootComponent->SetUsingAbsoluteScale(false);
+	}
+
+	AttachParent = nullptr;
+	bAttached = false;
 }
\ No newline at end of file
@@ -14,6 +14,7 @@ UOrbitFollow::UOrbitFollow()
 
 	BlendFunction = EEasingFunc::Linear;
 	DampParams = FDampParams();
+	Prediction = FPredictionParams();
 	FollowDamping = FVector(0.2f, 0.2f, 0.2f);
 	
 	CurrentRootPosition = FVector(0, 0, 0);
@@ -21,6 +22,10 @@ UOrbitFollow::UOrbitFollow()
 	CachedPitch = 0.0f;
 	Height = 0.0f;
 	Radius = 0.0f;
+	RadiusTableMinHeight = 0.0f;
+	RadiusTableHeightStep = 0.0f;
+	BakedNumOrbits = 0;
+	BakedBlendFunction = EEasingFunc::Linear;
 }
 
 void UOrbitFollow::UpdateComponent_Implementation(float DeltaTime)
@@ -31,10 +36,11 @@ void UOrbitFollow::UpdateComponent_Implementation(float DeltaTime)
 		if (Orbits.Num() == 0) return;
 
 		/** Follow position to track. */
-		FVector FollowPosition = FollowTarget->GetActorLocation();
+		FVector FollowPosition = GetTargetKinematics(FollowTarget.Get()).Position + GetPredictedOffset(FollowTarget.Get(), Prediction);
 
 		/** Transform into camera's local space. */
-		FVector LocalSpaceFollowPosition = UECameraLibrary::GetLocalSpacePositionWithVectors(CurrentRootPosition, GetOwningActor()->GetActorForwardVector(), GetOwningActor()->GetActorRightVector(), GetOwningActor()->GetActorUpVector(), FollowPosition);
+		const FECameraFrame& Frame = GetCameraFrame();
+		FVector LocalSpaceFollowPosition = UECameraLibrary::GetLocalSpacePositionWithVectors(CurrentRootPosition, Frame.Forward, Frame.Right, Frame.Up, FollowPosition);
 
 		/** Temporary (before damping) delta position. */
 		FVector TempDeltaPosition = LocalSpaceFollowPosition;
@@ -43,7 +49,7 @@ void UOrbitFollow::UpdateComponent_Implementation(float DeltaTime)
 		FVector DampedDeltaPosition = DampDeltaPosition(TempDeltaPosition, DeltaTime);
 
 		/** Transform DampedDeltaPosition from local space to world space.  */
-		DampedDeltaPosition = UKismetMathLibrary::TransformDirection(FTransform(GetOwningActor()->GetActorRotation(), CurrentRootPosition, FVector::OneVector), DampedDeltaPosition);
+		DampedDeltaPosition = Frame.Forward * DampedDeltaPosition.X + Frame.Right * DampedDeltaPosition.Y + Frame.Up * DampedDeltaPosition.Z;
 
 		/** Update cache root position and current root position. */
 		CachedRootPosition = CurrentRootPosition;
@@ -63,15 +69,9 @@ void UOrbitFollow::UpdateComponent_Implementation(float DeltaTime)
 		/** Evaluate radius. */
 		EvaluateRadius();	
 
-		/** Get world space orbit offset. */
-		FVector OrbitOffset = GetOrbitOffset();
-
-		/** Apply orbit offset. */
-		GetOwningActor()->SetActorLocation(CurrentRootPosition + OrbitOffset);
-
-		/** Calibrate camera orientation. */
-		FRotator DesiredRotation = UKismetMathLibrary::FindLookAtRotation(GetOwningActor()->GetActorLocation(), CurrentRootPosition);
-		GetOwningActor()->SetActorRotation(FRotator(DesiredRotation.Pitch, GetOwningActor()->GetActorRotation().Yaw, 0));
+		/** Solve location on orbit surface and orientation towards root in one step, and apply both at once. */
+		FTransform OrbitPose = SolveOrbitPose(CurrentRootPosition, GetOwningActor()->GetActorRotation().Yaw);
+		GetOwningActor()->SetActorLocationAndRotation(OrbitPose.GetLocation(), OrbitPose.GetRotation());
 	}
 }
 
@@ -83,7 +83,7 @@ void UOrbitFollow::ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserve
 	if (bPreserveState)
 	{
 		/** Reset Height to the place nearest to current camera's height,  */
-		FVector FollowPosition = FollowTarget->GetActorLocation();
+		FVector FollowPosition = GetTargetKinematics(FollowTarget.Get()).Position;
 		float CurrentHeight = PC->PlayerCameraManager->GetCameraLocation().Z - FollowPosition.Z;
 		Height = CurrentHeight;
 		Height = ConstrainHeight(Height);
@@ -94,8 +94,11 @@ void UOrbitFollow::ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserve
 	{
 		Height = (Orbits[0].Height + Orbits[Orbits.Num() - 1].Height) / 2;
 	}
+	/** Orbits may have been changed while this camera was not the view target. */
+	BakeRadiusTable();
+
 	/** Reset CurrentRootPosition and CachedRootPosition for stable camera transition. */
-	CurrentRootPosition = CachedRootPosition = FollowTarget->GetActorLocation();
+	CurrentRootPosition = CachedRootPosition = GetTargetKinematics(FollowTarget.Get()).Position;
 }
 
 FVector UOrbitFollow::DampDeltaPosition(const FVector& TempDeltaPosition, float DeltaTime)
@@ -125,31 +128,101 @@ float UOrbitFollow::ConstrainHeight(float InputHeight)
 	return OutputHeight;
 }
 
-void UOrbitFollow::EvaluateRadius()
+void UOrbitFollow::SetOrbits(const TArray<FOrbit>& InOrbits)
 {
-	if (Orbits.Num() == 1)
+	Orbits = InOrbits;
+	BakeRadiusTable();
+}
+
+void UOrbitFollow::SetBlendFunction(TEnumAsByte<EEasingFunc::Type> InBlendFunction)
+{
+	BlendFunction = InBlendFunction;
+	BakeRadiusTable();
+}
+
+void UOrbitFollow::BakeRadiusTable()
+{
+	BakedNumOrbits = Orbits.Num();
+	BakedBlendFunction = BlendFunction;
+	RadiusTable.Reset();
+	if (Orbits.Num() == 0) return;
+
+	/** A single orbit, or orbits all at one height, give a constant radius. */
+	const float MaxHeight = Orbits[0].Height;
+	const float MinHeight = Orbits[Orbits.Num() - 1].Height;
+	RadiusTableMinHeight = MinHeight;
+	if (Orbits.Num() == 1 || MaxHeight <= MinHeight)
 	{
-		Radius = Orbits[0].Radius;
+		RadiusTableHeightStep = 0.0f;
+		RadiusTable.Add(Orbits[0].Radius);
 		return;
 	}
 
+	RadiusTableHeightStep = (MaxHeight - MinHeight) / (RadiusTableSize - 1);
+	RadiusTable.SetNumUninitialized(RadiusTableSize);
+	for (int32 Index = 0; Index < RadiusTableSize; ++Index)
+	{
+		RadiusTable[Index] = EvaluateRadiusAtHeight(Index == RadiusTableSize - 1 ? MaxHeight : MinHeight + Index * RadiusTableHeightStep);
+	}
+}
+
+float UOrbitFollow::EvaluateRadiusAtHeight(float InHeight) const
+{
+	if (Orbits.Num() == 1) return Orbits[0].Radius;
+
 	FOrbit OrbitTop, OrbitBottom;
 	for (int index = 0; index < Orbits.Num() - 1; ++index)
-		if (Height <= Orbits[index].Height && Height >= Orbits[index + 1].Height)
+		if (InHeight <= Orbits[index].Height && InHeight >= Orbits[index + 1].Height)
 		{
 			OrbitTop = Orbits[index];
 			OrbitBottom = Orbits[index + 1];
 			break;
 		}
 
-	Radius = UKismetMathLibrary::Ease(OrbitBottom.Radius, OrbitTop.Radius, (Height - OrbitBottom.Height) / (OrbitTop.Height - OrbitBottom.Height), BlendFunction);
+	/** Coincident orbits have no interval to blend over. */
+	if (OrbitTop.Height <= OrbitBottom.Height) return OrbitTop.Radius;
+
+	return UKismetMathLibrary::Ease(OrbitBottom.Radius, OrbitTop.Radius, (InHeight - OrbitBottom.Height) / (OrbitTop.Height - OrbitBottom.Height), BlendFunction);
 }
 
-FVector UOrbitFollow::GetOrbitOffset()
+void UOrbitFollow::EvaluateRadius()
+{
+	if (RadiusTable.Num() == 0 || BakedNumOrbits != Orbits.Num() || BakedBlendFunction != BlendFunction) BakeRadiusTable();
+
+	if (RadiusTable.Num() == 1 || RadiusTableHeightStep <= 0.0f)
+	{
+		Radius = RadiusTable[0];
+		return;
+	}
+
+	/** Height is already constrained to orbit range, so the table position is always within bounds. */
+	const float Position = FMath::Clamp((Height - RadiusTableMinHeight) / RadiusTableHeightStep, 0.0f, float(RadiusTable.Num() - 1));
+	const int32 Index = FMath::Min(FMath::FloorToInt(Position), RadiusTable.Num() - 2);
+	Radius = FMath::Lerp(RadiusTable[Index], RadiusTable[Index + 1], Position - Index);
+}
+
+FTransform UOrbitFollow::SolveOrbitPose(const FVector& RootPosition, float Yaw) const
+{
+	/** Camera sits Height above root and Radius behind it along its horizontal heading, and looks back at root. */
+	double SinYaw, CosYaw;
+	FMath::SinCos(&SinYaw, &CosYaw, FMath::DegreesToRadians(double(Yaw)));
+	const FVector Location = RootPosition + FVector(-Radius * CosYaw, -Radius * SinYaw, Height);
+	const double Pitch = FMath::RadiansToDegrees(FMath::Atan2(-double(Height), double(Radius)));
+
+	return FTransform(FRotator(Pitch, Yaw, 0), Location);
+}
+
+#if WITH_EDITOR
+void UOrbitFollow::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
-	FVector Direction = GetOwningActor()->GetActorForwardVector();
-	Direction.Z = 0.0f;
-	Direction.Normalize();
+	Super::PostEditChangeProperty(PropertyChangedEvent);
 
-	return Height * FVector::UpVector + Radius * (-Direction);
-}
\ No newline at end of file
+	/** Orbits are edited element by element, so check the outermost member property. */
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UOrbitFollow, Orbits)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UOrbitFollow, BlendFunction))
+	{
+		BakeRadiusTable();
+	}
+}
+#endif
\ No newline at end of file
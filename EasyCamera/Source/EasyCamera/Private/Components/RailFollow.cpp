@@ -27,6 +27,7 @@ URailFollow::URailFollow()
 	ElapsedBlendTime = 0.0f;
 	ElapsedDurationTime = 0.0f;
 	CurrentKeyPoint = -1;
+	NearestPositionOnRail = -1;
 }
 
 void URailFollow::UpdateComponent_Implementation(float DeltaTime)
@@ -156,21 +157,17 @@ FTransform URailFollow::UpdateTransformOnRail()
 		return FTransform();
 	}
 
-	if (Rail)
+	if (Rail && RailCache.Update(Rail->GetRailSplineComponent()))
 	{
-		USplineComponent* Spline = Rail->GetRailSplineComponent();
-
-		float const SplineLen = Spline->GetSplineLength();
-		FVector const CameraPos = Spline->GetLocationAtDistanceAlongSpline(Rail->CurrentPositionOnRail * SplineLen, ESplineCoordinateSpace::World);
+		FTransform const CameraTransform = RailCache.GetTransformAtFraction(Rail->CurrentPositionOnRail);
 
 		if (bLockOrientationToRail)
 		{
-			FQuat const CameraRot = Spline->GetQuaternionAtDistanceAlongSpline(Rail->CurrentPositionOnRail * SplineLen, ESplineCoordinateSpace::World);
-			return FTransform(CameraRot, CameraPos);
+			return CameraTransform;
 		}
 		else
 		{
-			return FTransform(FQuat(), CameraPos);
+			return FTransform(FQuat(), CameraTransform.GetLocation());
 		}
 	}
 	else return FTransform();
@@ -178,19 +175,11 @@ FTransform URailFollow::UpdateTransformOnRail()
 
 float URailFollow::GetNormalizedPositionOnRailNearestToTarget(AActor* Target)
 {
-	/** Get the underlying spline. */
-	USplineComponent* Spline = Rail->GetRailSplineComponent();
-
-	/** Get posiiton on rail. */
-	float Position = Spline->FindInputKeyClosestToWorldLocation(Target->GetActorLocation());
-
-	/** Get number of splines. */
-	int SplineNumber = Spline->IsClosedLoop() ? Spline->GetNumberOfSplinePoints() : Spline->GetNumberOfSplinePoints() - 1;
-
-	/** Normalize position into [0,1]. */
-	Position /= SplineNumber;
+	/** Get posiiton on rail, as fraction of rail length, the same unit as FixedSpeed and Manual modes use. */
+	if (!RailCache.Update(Rail->GetRailSplineComponent())) return 0.0f;
+	NearestPositionOnRail = RailCache.FindFractionClosestToWorldLocation(GetTargetKinematics(Target).Position, NearestPositionOnRail);
 
-	return Position;
+	return NearestPositionOnRail;
 }
 
 void URailFollow::SetRailPositionAndUpdateCameraTransform(float Position)
@@ -277,4 +266,5 @@ void URailFollow::ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserveS
 		ElapsedDurationTime = 0.0f;
 		CurrentKeyPoint = -1;
 	}
+	NearestPositionOnRail = -1;
 }
\ No newline at end of file
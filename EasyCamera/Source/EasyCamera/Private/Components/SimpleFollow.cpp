@@ -15,6 +15,7 @@ USimpleFollow::USimpleFollow()
 	FollowOffset = FVector(0.0f, 0.0f, 0.0f);
 	AxisMasks = FVector(1.0f, 1.0f, 1.0f);
 	DampParams = FDampParams();
+	Prediction = FPredictionParams();
 	FollowDamping = FVector(0.0f, 0.0f, 0.0f);
 	PreviousLocation = FVector(0.0f, 0.0f, 0.0f);
 	ExactSpringVel = FVector(0.0f, 0.0f, 0.0f);
@@ -25,16 +26,10 @@ void USimpleFollow::UpdateComponent_Implementation(float DeltaTime)
 	if (FollowTarget != nullptr)
 	{
 		/** Get the *real* follow position, depending on FollowType. */
-		FVector FollowPosition = GetRealFollowLocation();
+		FVector FollowPosition = GetRealFollowLocation() + GetPredictedOffset(FollowTarget.Get(), Prediction);
 
-		/** Transform from world space to local space. */
-		FVector LocalSpaceFollowPosition = UECameraLibrary::GetLocalSpacePosition(GetOwningActor(), FollowPosition);
-
-		/** Temporary (before damping) delta position. */
-		FVector TempDeltaPosition = LocalSpaceFollowPosition;
-
-		/** Transform from local space back to world space. */
-		FVector WorldDeltaPosition = UKismetMathLibrary::TransformDirection(GetOwningActor()->GetActorTransform(), TempDeltaPosition);
+		/** Temporary (before damping) delta position, in world space. */
+		FVector WorldDeltaPosition = FollowPosition - GetCameraFrame().Position;
 
 		/** Apply axis masks. */
 		FVector MaskedDeltaPosition = ApplyAxisMask(WorldDeltaPosition);
@@ -53,17 +48,16 @@ void USimpleFollow::UpdateComponent_Implementation(float DeltaTime)
 FVector USimpleFollow::GetRealFollowLocation()
 {
 	FVector FollowPosition = FVector(0, 0, 0);
-	FVector TempFollowPosition = FollowTarget->GetActorLocation();
-	FRotator TempRotation = FollowTarget->GetActorRotation();
+	const FECameraTargetKinematics Kinematics = GetTargetKinematics(FollowTarget.Get());
+	FVector TempFollowPosition = Kinematics.Position;
+	FRotator TempRotation = Kinematics.Rotation.Rotator();
 
 	/** If SocketName is not empty, use the socket's position. */
-	if (SocketName != "")
+	if (SocketName != NAME_None)
 	{
-		UActorComponent* ActorComponent = FollowTarget->GetComponentByClass(USkeletalMeshComponent::StaticClass());
-		if (ActorComponent != nullptr)
+		FTransform SocketTransform;
+		if (GetTargetSocketTransform(FollowTarget.Get(), SocketName, SocketTransform))
 		{
-			USkeletalMeshComponent* SkeletonComponent = Cast<USkeletalMeshComponent>(ActorComponent);
-			FTransform SocketTransform = SkeletonComponent->GetSocketTransform(FName(SocketName));
 			TempFollowPosition = SocketTransform.GetLocation();
 			TempRotation = SocketTransform.Rotator();
 		}
@@ -89,7 +83,7 @@ FVector USimpleFollow::DampDeltaPosition(const FVector& TempDeltaPosition, float
 		FVector CurrentPos = FVector(0, 0, 0);
 		FVector CurrentVel = ExactSpringVel;
 		FVector TargetPos = TempDeltaPosition;
-		const FVector TargetVel = FollowTarget->GetVelocity() / 1.1f;
+		const FVector TargetVel = GetTargetKinematics(FollowTarget.Get()).Velocity / 1.1f;
 		FVector OutPos = FVector(0, 0, 0);
 		FVector& OutVel = ExactSpringVel;
 
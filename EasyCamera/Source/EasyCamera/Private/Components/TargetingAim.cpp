@@ -17,10 +17,16 @@ UTargetingAim::UTargetingAim()
 	bLocalRotation = false;
 	AimOffset = FVector(0.0f, 0.0f, 0.0f);
 	DampParams = FDampParams();
+	Prediction = FPredictionParams();
 	AimDamping = FVector(0.0f, 0.0f, 0.0f);
 	ScreenOffset = FVector2f(0.0f, 0.0f);
 	ScreenOffsetWidth = FVector2f(-0.1f, 0.1f);
 	ScreenOffsetHeight = FVector2f(-0.1f, 0.1f);
+	CachedFieldOfView = -1.0f;
+	CachedAspectRatio = -1.0f;
+	HFieldOfView = 0.0;
+	VFieldOfView = 0.0;
+	CameraElevation = 0.0;
 }
 
 void UTargetingAim::UpdateComponent_Implementation(float DeltaTime)
@@ -33,23 +39,25 @@ void UTargetingAim::UpdateComponent_Implementation(float DeltaTime)
 		/** If camera is too close to aim target, return. */
 		if (CheckIfTooClose(AimPosition)) return;
 
-		/** Temporary delta rotation before damping. */
-		FRotator TempDeltaRotation = FRotator(0, 0, 0);
+		/** Angles from camera forward to aim position, solved directly from the aim direction. */
+		UpdateFieldOfView();
+		const FVector2D CenteredDeltaAngles = GetCenteredDeltaAngles(AimPosition);
 
-		/** Set delta rotation. */
-		SetDeltaRotation(AimPosition, TempDeltaRotation);
+		/** Temporary delta angles before damping. */
+		const FVector2D TempDeltaAngles = FVector2D(CenteredDeltaAngles.X - ScreenOffset.X * HFieldOfView, CenteredDeltaAngles.Y - ScreenOffset.Y * VFieldOfView);
 
-		/** Get damped delta rotation. */
-		FRotator DampedDeltaRotation = DampDeltaRotation(TempDeltaRotation, DeltaTime, AimPosition);
+		/** Get damped delta angles, clamped to the dead zone. */
+		FVector2D DampedDeltaAngles = DampDeltaAngles(TempDeltaAngles, DeltaTime);
+		EnsureWithinBounds(CenteredDeltaAngles, DampedDeltaAngles);
 
-		/** Apply damped delta rotation. */
+		/** Never pitch past the poles, where world space yaw would flip. */
 		if (!bLocalRotation)
 		{
-			GetOwningActor()->AddActorLocalRotation(FRotator(DampedDeltaRotation.Pitch, 0, 0));
-			GetOwningActor()->AddActorWorldRotation(FRotator(0, DampedDeltaRotation.Yaw, 0));
-
+			DampedDeltaAngles.Y = FMath::Clamp(DampedDeltaAngles.Y, -89.9 - CameraElevation, 89.9 - CameraElevation);
 		}
-		else GetOwningActor()->AddActorLocalRotation(DampedDeltaRotation);
+
+		/** Apply damped delta angles. */
+		GetOwningActor()->SetActorRotation(ApplyDeltaAngles(GetOwningActor()->GetActorQuat(), DampedDeltaAngles));
 
 		/** Update variables for HUD. */
 		RealAimPosition = AimPosition;
@@ -62,62 +70,82 @@ bool UTargetingAim::CheckIfTooClose(const FVector& AimPosition)
 	return UKismetMathLibrary::NearlyEqual_FloatFloat(Distance, 0, 0.001);
 }
 
-void UTargetingAim::SetDeltaRotation(const FVector& AimPosition, FRotator& TempDeltaRotation)
+void UTargetingAim::UpdateFieldOfView()
+{
+	const UCameraComponent* CameraComponent = OwningCamera->GetCameraComponent();
+	if (CameraComponent->FieldOfView != CachedFieldOfView || CameraComponent->AspectRatio != CachedAspectRatio)
+	{
+		CachedFieldOfView = CameraComponent->FieldOfView;
+		CachedAspectRatio = CameraComponent->AspectRatio;
+		HFieldOfView = CachedFieldOfView;
+		VFieldOfView = 2.0 * FMath::RadiansToDegrees(FMath::Atan(FMath::Tan(FMath::DegreesToRadians(CachedFieldOfView * 0.5)) / FMath::Max(CachedAspectRatio, UE_KINDA_SMALL_NUMBER)));
+	}
+}
+
+FVector2D UTargetingAim::GetCenteredDeltaAngles(const FVector& AimPosition)
 {
-	/** Version 1: Rotate at world space. */
+	const FECameraFrame& Frame = GetCameraFrame();
+	const FVector Diff = AimPosition - Frame.Position;
+
+	/** Version 1: Yaw about world up, pitch about local right. */
 	if (!bLocalRotation)
 	{
-		FRotator CenteredDeltaRotation = UKismetMathLibrary::NormalizedDeltaRotator(UKismetMathLibrary::FindLookAtRotation(GetOwningActor()->GetActorLocation(), AimPosition), GetOwningActor()->GetActorRotation());
-		TempDeltaRotation.Yaw = CenteredDeltaRotation.Yaw - ScreenOffset.X * OwningCamera->GetCameraComponent()->FieldOfView;
-		TempDeltaRotation.Pitch = CenteredDeltaRotation.Pitch - ScreenOffset.Y * 2.0f * UKismetMathLibrary::DegAtan(UKismetMathLibrary::DegTan(OwningCamera->GetCameraComponent()->FieldOfView / 2) / OwningCamera->GetCameraComponent()->AspectRatio);
-		TempDeltaRotation.Roll = 0;
+		/** For a camera without roll, this combination of forward and up is the unit heading, and stays valid when looking straight up or down. */
+		const FVector2D Heading = FVector2D(
+			Frame.Forward.X * Frame.Up.Z - Frame.Up.X * Frame.Forward.Z,
+			Frame.Forward.Y * Frame.Up.Z - Frame.Up.Y * Frame.Forward.Z).GetSafeNormal();
+		const FVector2D Planar = FVector2D(Diff.X, Diff.Y);
+		const double PlanarLength = Planar.Size();
+
+		/** Heading towards a target right above or below the camera is undefined, so keep current yaw. */
+		const double Yaw = PlanarLength > UE_KINDA_SMALL_NUMBER ? FMath::Atan2(Heading ^ Planar, Heading | Planar) : 0.0;
+		CameraElevation = FMath::RadiansToDegrees(FMath::Atan2(Frame.Forward.Z, FVector2D(Frame.Forward.X, Frame.Forward.Y).Size()));
+		const double Pitch = FMath::RadiansToDegrees(FMath::Atan2(Diff.Z, PlanarLength)) - CameraElevation;
+
+		return FVector2D(FMath::RadiansToDegrees(Yaw), Pitch);
 	}
 
-	/** Version 2: Rotate at local space. */
+	/** Version 2: Yaw about local up, pitch about local right. */
 	else
 	{
-		FVector Diff = AimPosition - GetOwningActor()->GetActorLocation();
+		const FVector LocalSpaceAimPosition = FVector(Diff | Frame.Forward, Diff | Frame.Right, Diff | Frame.Up);
+		const double Yaw = FMath::Atan2(LocalSpaceAimPosition.Y, LocalSpaceAimPosition.X);
+		const double Pitch = FMath::Atan2(LocalSpaceAimPosition.Z, FVector2D(LocalSpaceAimPosition.X, LocalSpaceAimPosition.Y).Size());
 
-		FVector ForwardVector = GetOwningActor()->GetActorForwardVector();
-		FVector RightVector = GetOwningActor()->GetActorRightVector();
-		FVector UpVector = GetOwningActor()->GetActorUpVector();
-
-		FVector LocalSpaceAimPosition =
-			UKismetMathLibrary::MakeVector(ForwardVector.X, RightVector.X, UpVector.X) * Diff.X +
-			UKismetMathLibrary::MakeVector(ForwardVector.Y, RightVector.Y, UpVector.Y) * Diff.Y +
-			UKismetMathLibrary::MakeVector(ForwardVector.Z, RightVector.Z, UpVector.Z) * Diff.Z;
-
-		FRotator CenteredDeltaRotation = UKismetMathLibrary::NormalizedDeltaRotator(UKismetMathLibrary::FindLookAtRotation(FVector(0, 0, 0), LocalSpaceAimPosition), FRotator(0, 0, 0));
-		TempDeltaRotation.Yaw = CenteredDeltaRotation.Yaw - ScreenOffset.X * OwningCamera->GetCameraComponent()->FieldOfView;
-		TempDeltaRotation.Pitch = CenteredDeltaRotation.Pitch - ScreenOffset.Y * 2.0f * UKismetMathLibrary::DegAtan(UKismetMathLibrary::DegTan(OwningCamera->GetCameraComponent()->FieldOfView / 2) / OwningCamera->GetCameraComponent()->AspectRatio);
-		TempDeltaRotation.Roll = 0;
+		return FVector2D(FMath::RadiansToDegrees(Yaw), FMath::RadiansToDegrees(Pitch));
 	}
 }
 
-FRotator UTargetingAim::DampDeltaRotation(const FRotator& TempDeltaRotation, float DeltaTime, const FVector& AimPosition)
+FVector2D UTargetingAim::DampDeltaAngles(const FVector2D& TempDeltaAngles, float DeltaTime) const
 {
-	FRotator DampedDeltaRotation = FRotator(0, 0, 0);
-	UECameraLibrary::DamperRotatorWithDifferentDampTime(DampParams, DeltaTime, TempDeltaRotation, AimDamping, DampedDeltaRotation);
-	EnsureWithinBounds(DampedDeltaRotation, AimPosition);
+	FVector2D DampedDeltaAngles = FVector2D(0, 0);
+	UECameraLibrary::DamperValue(DampParams, DeltaTime, TempDeltaAngles.X, AimDamping.Z, DampedDeltaAngles.X);
+	UECameraLibrary::DamperValue(DampParams, DeltaTime, TempDeltaAngles.Y, AimDamping.Y, DampedDeltaAngles.Y);
 
-	return DampedDeltaRotation;
+	return DampedDeltaAngles;
 }
 
-void UTargetingAim::EnsureWithinBounds(FRotator& DampedDeltaRotation, const FVector& AimPosition)
+void UTargetingAim::EnsureWithinBounds(const FVector2D& CenteredDeltaAngles, FVector2D& DampedDeltaAngles) const
 {
-	double VFieldOfView = 2.0f * UKismetMathLibrary::DegAtan(UKismetMathLibrary::DegTan(OwningCamera->GetCameraComponent()->FieldOfView / 2) / OwningCamera->GetCameraComponent()->AspectRatio);
-	double LeftBound = (ScreenOffset.X + ScreenOffsetWidth.X) * OwningCamera->GetCameraComponent()->FieldOfView;
-	double RightBound = (ScreenOffset.X + ScreenOffsetWidth.Y) * OwningCamera->GetCameraComponent()->FieldOfView;
-	double BottomBound = (ScreenOffset.Y + ScreenOffsetHeight.X) * VFieldOfView;
-	double TopBound = (ScreenOffset.Y + ScreenOffsetHeight.Y) * VFieldOfView;
-
-	FQuat DesiredQuat = GetOwningActor()->GetActorRotation().Quaternion();
-	DesiredQuat = FQuat(FRotator(0, DampedDeltaRotation.Yaw, 0)) * DesiredQuat * FQuat(FRotator(DampedDeltaRotation.Pitch, 0, 0));
-	FRotator DesiredRotation = DesiredQuat.Rotator();
-
-	FRotator ResultRotationDiff = UKismetMathLibrary::NormalizedDeltaRotator(UKismetMathLibrary::FindLookAtRotation(GetOwningActor()->GetActorLocation(), AimPosition), DesiredRotation);
-	if (ResultRotationDiff.Yaw < LeftBound) DampedDeltaRotation.Yaw += ResultRotationDiff.Yaw - LeftBound;
-	if (ResultRotationDiff.Yaw > RightBound) DampedDeltaRotation.Yaw += ResultRotationDiff.Yaw - RightBound;
-	if (ResultRotationDiff.Pitch < BottomBound) DampedDeltaRotation.Pitch += ResultRotationDiff.Pitch - BottomBound;
-	if (ResultRotationDiff.Pitch > TopBound) DampedDeltaRotation.Pitch += ResultRotationDiff.Pitch - TopBound;
-}
\ No newline at end of file
+	const double LeftBound = (ScreenOffset.X + ScreenOffsetWidth.X) * HFieldOfView;
+	const double RightBound = (ScreenOffset.X + ScreenOffsetWidth.Y) * HFieldOfView;
+	const double BottomBound = (ScreenOffset.Y + ScreenOffsetHeight.X) * VFieldOfView;
+	const double TopBound = (ScreenOffset.Y + ScreenOffsetHeight.Y) * VFieldOfView;
+
+	/** Twist and swing are applied about independent axes, so the residual angles after rotating are the centered angles minus the applied deltas. */
+	const FVector2D Residual = CenteredDeltaAngles - DampedDeltaAngles;
+	if (Residual.X < LeftBound) DampedDeltaAngles.X += Residual.X - LeftBound;
+	if (Residual.X > RightBound) DampedDeltaAngles.X += Residual.X - RightBound;
+	if (Residual.Y < BottomBound) DampedDeltaAngles.Y += Residual.Y - BottomBound;
+	if (Residual.Y > TopBound) DampedDeltaAngles.Y += Residual.Y - TopBound;
+}
+
+FQuat UTargetingAim::ApplyDeltaAngles(const FQuat& Rotation, const FVector2D& DeltaAngles) const
+{
+	const FQuat YawQuat = FQuat(FVector::ZAxisVector, FMath::DegreesToRadians(DeltaAngles.X));
+	/** Positive pitch lifts the forward axis, which is a negative rotation about the right axis. */
+	const FQuat PitchQuat = FQuat(FVector::YAxisVector, -FMath::DegreesToRadians(DeltaAngles.Y));
+
+	if (!bLocalRotation) return YawQuat * Rotation * PitchQuat;
+	else return Rotation * YawQuat * PitchQuat;
+}
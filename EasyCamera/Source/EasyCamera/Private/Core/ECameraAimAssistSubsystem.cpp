@@ -0,0 +1,298 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#include "Core/ECameraAimAssistSubsystem.h"
+#include "Utils/ECameraAimAssistTargetComponent.h"
+#include "Utils/ECameraLibrary.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+
+UECameraAimAssistSubsystem::UECameraAimAssistSubsystem()
+{
+	PrunedFrame = MAX_uint64;
+	CellSize = 1000.0;
+}
+
+void UECameraAimAssistSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+
+	for (const auto& Binding : RootBindings)
+	{
+		if (USceneComponent* Root = Binding.Value.Key.Get()) Root->TransformUpdated.Remove(Binding.Value.Value);
+	}
+	RootBindings.Empty();
+
+	Super::Deinitialize();
+}
+
+void UECameraAimAssistSubsystem::RegisterTarget(UECameraAimAssistTargetComponent* Component, AActor* Actor, const FVector& Offset)
+{
+	if (Component == nullptr || Actor == nullptr || SourceIndices.Contains(Component)) return;
+
+	SourceIndices.Add(Component, AddCandidate(Actor, Offset, INDEX_NONE, Component));
+}
+
+void UECameraAimAssistSubsystem::UnregisterTarget(UECameraAimAssistTargetComponent* Component)
+{
+	if (int32* Index = SourceIndices.Find(Component))
+	{
+		RemoveCandidateAt(*Index);
+	}
+}
+
+void UECameraAimAssistSubsystem::SetTargetOffset(UECameraAimAssistTargetComponent* Component, const FVector& Offset)
+{
+	if (int32* Index = SourceIndices.Find(Component))
+	{
+		Offsets[*Index] = Offset;
+		UpdateCandidatePosition(*Index);
+	}
+}
+
+void UECameraAimAssistSubsystem::GetRelevantTypes(const TArray<FOffsetActorType>& TargetTypes, TBitArray<>& OutRelevantTypes)
+{
+	OutRelevantTypes.Init(false, TrackedTypes.Num());
+
+	UWorld* World = GetWorld();
+	for (const FOffsetActorType& TargetType : TargetTypes)
+	{
+		if (TargetType.ActorType == nullptr) continue;
+
+		int32 TypeIndex = TrackedTypes.IndexOfByPredicate([&TargetType](const FOffsetActorType& TrackedType)
+			{
+				return TrackedType.ActorType == TargetType.ActorType && TrackedType.Offset == TargetType.Offset;
+			});
+
+		/** First request of this type. Scan the world once, and keep up with actors spawned or streamed in later. */
+		if (TypeIndex == INDEX_NONE && World != nullptr)
+		{
+			TypeIndex = TrackedTypes.Add(TargetType);
+			OutRelevantTypes.Add(false);
+
+			for (TActorIterator<AActor> It(World, TargetType.ActorType); It; ++It)
+			{
+				AddCandidate(*It, TargetType.Offset, TypeIndex, nullptr);
+			}
+
+			if (!ActorSpawnedHandle.IsValid())
+			{
+				ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UECameraAimAssistSubsystem::OnActorSpawned));
+				LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UECameraAimAssistSubsystem::OnLevelAdded);
+			}
+		}
+
+		if (TypeIndex != INDEX_NONE) OutRelevantTypes[TypeIndex] = true;
+	}
+}
+
+void UECameraAimAssistSubsystem::PruneCandidates()
+{
+	if (PrunedFrame == GFrameCounter) return;
+	PrunedFrame = GFrameCounter;
+
+	/** Iterate backwards, since removal swaps the last candidate into the removed slot. */
+	for (int32 Index = Actors.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Actors[Index].IsValid()) RemoveCandidateAt(Index);
+	}
+
+	FlushMovedCandidates();
+}
+
+void UECameraAimAssistSubsystem::QueryCylinder(const FVector& Start, const FVector& Direction, double Length, double Radius, TArray<int32, TMemStackAllocator<>>& OutIndices)
+{
+	FlushMovedCandidates();
+
+	const FVector End = Start + Direction * Length;
+	const FIntVector MinCell = GetCell(Start.ComponentMin(End) - FVector(Radius));
+	const FIntVector MaxCell = GetCell(Start.ComponentMax(End) + FVector(Radius));
+
+	/** A cell may intersect the cylinder only if its center is closer to the axis than the radius plus half its diagonal. */
+	const double CellReach = Radius + 0.5 * FMath::Sqrt(3.0) * CellSize;
+	auto IntersectsCylinder = [&](const FIntVector& Cell)
+	{
+		const FVector CellCenter = (FVector(Cell) + FVector(0.5)) * CellSize;
+		return FMath::PointDistToSegmentSquared(CellCenter, Start, End) <= CellReach * CellReach;
+	};
+
+	/** When the query covers more cells than are occupied, walking occupied cells is cheaper. */
+	const int64 NumCells = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1) * int64(MaxCell.Z - MinCell.Z + 1);
+	if (NumCells > Grid.Num())
+	{
+		for (const auto& Pair : Grid)
+		{
+			if (IntersectsCylinder(Pair.Key)) OutIndices.Append(Pair.Value);
+		}
+		return;
+	}
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const FIntVector Cell(X, Y, Z);
+				const TArray<int32>* CellCandidates = Grid.Find(Cell);
+				if (CellCandidates != nullptr && IntersectsCylinder(Cell)) OutIndices.Append(*CellCandidates);
+			}
+		}
+	}
+}
+
+int32 UECameraAimAssistSubsystem::AddCandidate(AActor* Actor, const FVector& Offset, int32 TypeIndex, TObjectKey<UECameraAimAssistTargetComponent> Source)
+{
+	USceneComponent* Root = Actor->GetRootComponent();
+
+	Actors.Add(Actor);
+	Offsets.Add(Offset);
+	Types.Add(TypeIndex);
+	Sources.Add(Source);
+	Roots.Add(Root);
+	const FVector Position = GetCandidatePosition(Actors.Num() - 1);
+	PositionsX.Add(Position.X);
+	PositionsY.Add(Position.Y);
+	PositionsZ.Add(Position.Z);
+	const int32 Index = Cells.Add(GetCell(Position));
+	Grid.FindOrAdd(Cells[Index]).Add(Index);
+
+	/** Watch root component so that the candidate is re-bucketed only when it moves. */
+	if (Root != nullptr)
+	{
+		if (!RootBindings.Contains(Root))
+		{
+			FDelegateHandle Handle = Root->TransformUpdated.AddUObject(this, &UECameraAimAssistSubsystem::OnRootComponentMoved);
+			RootBindings.Add(Root, TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>(Root, Handle));
+		}
+		RootCandidates.Add(Root, Index);
+	}
+
+	return Index;
+}
+
+void UECameraAimAssistSubsystem::RemoveCandidateAt(int32 Index)
+{
+	if (Types[Index] == INDEX_NONE) SourceIndices.Remove(Sources[Index]);
+
+	const int32 LastIndex = Actors.Num() - 1;
+	if (Index != LastIndex && Types[LastIndex] == INDEX_NONE)
+	{
+		SourceIndices.Add(Sources[LastIndex], Index);
+	}
+
+	/** Remove from grid and from root component watching. */
+	TArray<int32>& CellCandidates = Grid.FindChecked(Cells[Index]);
+	CellCandidates.RemoveSingleSwap(Index);
+	if (CellCandidates.Num() == 0) Grid.Remove(Cells[Index]);
+
+	const TObjectKey<USceneComponent> RootKey = Roots[Index];
+	if (RootCandidates.RemoveSingle(RootKey, Index) > 0 && RootCandidates.Find(RootKey) == nullptr)
+	{
+		TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle> Binding;
+		if (RootBindings.RemoveAndCopyValue(RootKey, Binding))
+		{
+			if (USceneComponent* Root = Binding.Key.Get()) Root->TransformUpdated.Remove(Binding.Value);
+		}
+		MovedRoots.Remove(RootKey);
+	}
+
+	/** Last candidate is about to take Index, so fix up its references. */
+	if (Index != LastIndex)
+	{
+		TArray<int32>& LastCellCandidates = Grid.FindChecked(Cells[LastIndex]);
+		LastCellCandidates[LastCellCandidates.IndexOfByKey(LastIndex)] = Index;
+		if (RootCandidates.RemoveSingle(Roots[LastIndex], LastIndex) > 0) RootCandidates.Add(Roots[LastIndex], Index);
+	}
+
+	Actors.RemoveAtSwap(Index);
+	Offsets.RemoveAtSwap(Index);
+	Types.RemoveAtSwap(Index);
+	Sources.RemoveAtSwap(Index);
+	Roots.RemoveAtSwap(Index);
+	Cells.RemoveAtSwap(Index);
+	PositionsX.RemoveAtSwap(Index);
+	PositionsY.RemoveAtSwap(Index);
+	PositionsZ.RemoveAtSwap(Index);
+}
+
+FVector UECameraAimAssistSubsystem::GetCandidatePosition(int32 Index) const
+{
+	AActor* Actor = Actors[Index].Get();
+	return Actor != nullptr ? UECameraLibrary::GetPositionWithLocalOffset(Actor, Offsets[Index]) : FVector::ZeroVector;
+}
+
+FIntVector UECameraAimAssistSubsystem::GetCell(const FVector& Position) const
+{
+	return FIntVector(FMath::FloorToInt(Position.X / CellSize), FMath::FloorToInt(Position.Y / CellSize), FMath::FloorToInt(Position.Z / CellSize));
+}
+
+void UECameraAimAssistSubsystem::UpdateCandidatePosition(int32 Index)
+{
+	const FVector Position = GetCandidatePosition(Index);
+	PositionsX[Index] = Position.X;
+	PositionsY[Index] = Position.Y;
+	PositionsZ[Index] = Position.Z;
+
+	const FIntVector Cell = GetCell(Position);
+	if (Cell == Cells[Index]) return;
+
+	TArray<int32>& CellCandidates = Grid.FindChecked(Cells[Index]);
+	CellCandidates.RemoveSingleSwap(Index);
+	if (CellCandidates.Num() == 0) Grid.Remove(Cells[Index]);
+
+	Cells[Index] = Cell;
+	Grid.FindOrAdd(Cell).Add(Index);
+}
+
+void UECameraAimAssistSubsystem::FlushMovedCandidates()
+{
+	if (MovedRoots.Num() == 0) return;
+
+	TArray<int32, TInlineAllocator<8>> RootIndices;
+	for (const TObjectKey<USceneComponent>& RootKey : MovedRoots)
+	{
+		RootIndices.Reset();
+		RootCandidates.MultiFind(RootKey, RootIndices);
+		for (int32 Index : RootIndices) UpdateCandidatePosition(Index);
+	}
+	MovedRoots.Reset();
+}
+
+void UECameraAimAssistSubsystem::OnRootComponentMoved(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	MovedRoots.Add(Component);
+}
+
+void UECameraAimAssistSubsystem::AddActorOfTrackedTypes(AActor* Actor)
+{
+	if (Actor == nullptr) return;
+
+	for (int32 TypeIndex = 0; TypeIndex < TrackedTypes.Num(); ++TypeIndex)
+	{
+		if (Actor->IsA(TrackedTypes[TypeIndex].ActorType))
+		{
+			AddCandidate(Actor, TrackedTypes[TypeIndex].Offset, TypeIndex, nullptr);
+		}
+	}
+}
+
+void UECameraAimAssistSubsystem::OnActorSpawned(AActor* Actor)
+{
+	AddActorOfTrackedTypes(Actor);
+}
+
+void UECameraAimAssistSubsystem::OnLevelAdded(ULevel* Level, UWorld* World)
+{
+	if (Level == nullptr || World != GetWorld()) return;
+
+	for (AActor* Actor : Level->Actors)
+	{
+		AddActorOfTrackedTypes(Actor);
+	}
+}
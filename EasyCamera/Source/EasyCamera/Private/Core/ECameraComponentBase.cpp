@@ -2,6 +2,8 @@
 
 
 #include "Core/ECameraComponentBase.h"
+#include "Core/ECameraTargetSubsystem.h"
+#include "Utils/ECameraLibrary.h"
 
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
@@ -9,6 +11,42 @@
 
 UECameraComponentBase::UECameraComponentBase() { }
 
+FECameraTargetKinematics UECameraComponentBase::GetTargetKinematics(const AActor* Target) const
+{
+	UWorld* World = OwningActor != nullptr ? OwningActor->GetWorld() : nullptr;
+	if (UECameraTargetSubsystem* TargetSubsystem = World != nullptr ? World->GetSubsystem<UECameraTargetSubsystem>() : nullptr)
+	{
+		return TargetSubsystem->GetKinematics(Target);
+	}
+
+	FECameraTargetKinematics Kinematics;
+	if (Target != nullptr)
+	{
+		Kinematics.Position = Target->GetActorLocation();
+		Kinematics.Rotation = Target->GetActorQuat();
+		Kinematics.Velocity = Target->GetVelocity();
+	}
+	return Kinematics;
+}
+
+FVector UECameraComponentBase::GetPredictedOffset(const AActor* Target, const FPredictionParams& PredictionParams) const
+{
+	if (!PredictionParams.bEnablePrediction || Target == nullptr) return FVector::ZeroVector;
+	return UECameraLibrary::GetPredictedOffset(GetTargetKinematics(Target), PredictionParams);
+}
+
+bool UECameraComponentBase::GetTargetSocketTransform(const AActor* Target, FName SocketName, FTransform& OutTransform)
+{
+	if (SocketCache.Update(Target, SocketName))
+	{
+		OutTransform = SocketCache.GetTransform();
+		return true;
+	}
+
+	OutTransform = Target != nullptr ? Target->GetActorTransform() : FTransform::Identity;
+	return false;
+}
+
 bool UECameraComponentBase::IsValid()
 {
 	return true;
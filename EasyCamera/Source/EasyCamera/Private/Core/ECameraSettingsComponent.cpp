@@ -4,16 +4,21 @@
 #include "Core/ECameraBase.h"
 #include "Core/ECameraManager.h"
 #include "Core/ECameraComponentBase.h"
+#include "Core/ECameraTargetSubsystem.h"
 #include "Components/ECameraComponentAim.h"
 #include "Components/ECameraComponentFollow.h"
-#include "Components/HardLockAim.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "Extensions/ECameraExtensionBase.h"
 #include "Extensions/KeyframeExtension.h"
+#include "Utils/ECameraGroupActor.h"
+#include "Utils/ECameraGroupActorComponent.h"
 #include "Utils/ECameraTypes.h"
 #include "Kismet/GameplayStatics.h"
 #include "Camera/CameraComponent.h"
 #include "Engine/Engine.h"
+#include "Misc/MemStack.h"
 #include "Engine/World.h"
+#include "GameFramework/MovementComponent.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 
@@ -22,6 +27,9 @@ UECameraSettingsComponent::UECameraSettingsComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+
+	bLateUpdate = false;
+	LateUpdateFrame = MAX_uint64;
 }
 
 void UECameraSettingsComponent::OnRegister()
@@ -31,6 +39,22 @@ void UECameraSettingsComponent::OnRegister()
 	InitializeECameraComponents();
 }
 
+void UECameraSettingsComponent::OnUnregister()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UECameraTargetSubsystem* TargetSubsystem = World->GetSubsystem<UECameraTargetSubsystem>())
+		{
+			TargetSubsystem->UnregisterTarget(RegisteredFollowTarget);
+			TargetSubsystem->UnregisterTarget(RegisteredAimTarget);
+		}
+	}
+	RegisteredFollowTarget = TObjectKey<AActor>();
+	RegisteredAimTarget = TObjectKey<AActor>();
+
+	Super::OnUnregister();
+}
+
 void UECameraSettingsComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -42,18 +66,35 @@ void UECameraSettingsComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 
 	if (IsActive())
 	{
+		/** Temporaries allocated on the memory stack by components are released when this tick ends. */
+		FMemMark FrameMark(FMemStack::Get());
+
+		/** Group actors only update while an active camera uses them. */
+		if (AECameraGroupActor* FollowGroupActor = Cast<AECameraGroupActor>(FollowTarget))
+			FollowGroupActor->CameraGroupActorComponent->MarkConsumed();
+		if (AECameraGroupActor* AimGroupActor = Cast<AECameraGroupActor>(AimTarget))
+			AimGroupActor->CameraGroupActorComponent->MarkConsumed();
+
 		OnPreTickComponent.Broadcast();
 		for (EStage Stage : TEnumRange<EStage>())
 		{
 			/** Follow component and aim component first. */
 			for (UECameraComponentBase* Component : ComponentContainer)
 			{
-				if (Component != nullptr && Component->GetStage() == Stage) Component->UpdateComponent(DeltaTime);		
+				if (Component != nullptr && Component->GetStage() == Stage)
+				{
+					UpdateCameraFrame();
+					Component->UpdateComponent(DeltaTime);
+				}
 			}
 			/** Then extensions. */
 			for (UECameraExtensionBase* Component : Extensions)
 			{
-				if (Component != nullptr && Component->GetStage() == Stage) Component->UpdateComponent(DeltaTime);
+				if (Component != nullptr && Component->GetStage() == Stage)
+				{
+					UpdateCameraFrame();
+					Component->UpdateComponent(DeltaTime);
+				}
 			}
 		}
 		OnPostTickComponent.Broadcast();
@@ -102,6 +143,8 @@ AActor* UECameraSettingsComponent::SetFollowTarget(AActor* NewFollowTarget)
 	FollowTarget = NewFollowTarget;
 	if (FollowComponent != nullptr)
 		FollowComponent->SetFollowTarget(NewFollowTarget);
+	RefreshTargetRegistration();
+	RefreshTickPrerequisites();
 	return NewFollowTarget;
 }
 
@@ -120,6 +163,8 @@ AActor* UECameraSettingsComponent::SetAimTarget(AActor* NewAimTarget)
 	AimTarget = NewAimTarget;
 	if (AimComponent != nullptr)
 		AimComponent->SetAimTarget(NewAimTarget);
+	RefreshTargetRegistration();
+	RefreshTickPrerequisites();
 	return NewAimTarget;
 }
 
@@ -127,8 +172,7 @@ UECameraExtensionBase* UECameraSettingsComponent::GetExtensionOfClass(TSubclassO
 {
 	UECameraExtensionBase* Result = nullptr;
 
-	TArray<UECameraExtensionBase*> OwningExtensions = GetExtensions();
-	for (UECameraExtensionBase* Extension : OwningExtensions)
+	for (UECameraExtensionBase* Extension : Extensions)
 	{
 		if (Extension->IsA<UKeyframeExtension>())
 		{
@@ -150,9 +194,90 @@ UECameraComponentAim* UECameraSettingsComponent::GetAimComponent() const
 	return AimComponent;
 }
 
-TArray<UECameraExtensionBase*> UECameraSettingsComponent::GetExtensions() const
+void UECameraSettingsComponent::UpdateCameraFrame()
 {
-	return Extensions;
+	if (AActor* Owner = GetOwner())
+	{
+		CameraFrame.Set(Owner->GetActorLocation(), Owner->GetActorQuat());
+	}
+}
+
+void UECameraSettingsComponent::LateUpdate(float DeltaTime)
+{
+	/** Camera manager may update the same view target more than once per frame. */
+	if (!bLateUpdate || LateUpdateFrame == GFrameCounter || !IsActive()) return;
+	LateUpdateFrame = GFrameCounter;
+
+	/** Temporaries allocated on the memory stack by components are released when late update ends. */
+	FMemMark LateMark(FMemStack::Get());
+
+	for (UECameraComponentBase* Component : ComponentContainer)
+	{
+		if (Component != nullptr) Component->LateUpdateComponent(DeltaTime);
+	}
+}
+
+void UECameraSettingsComponent::RefreshTargetRegistration()
+{
+	UWorld* World = GetWorld();
+	UECameraTargetSubsystem* TargetSubsystem = World != nullptr ? World->GetSubsystem<UECameraTargetSubsystem>() : nullptr;
+	if (TargetSubsystem == nullptr) return;
+
+	if (RegisteredFollowTarget != TObjectKey<AActor>(FollowTarget.Get()))
+	{
+		TargetSubsystem->UnregisterTarget(RegisteredFollowTarget);
+		TargetSubsystem->RegisterTarget(FollowTarget);
+		RegisteredFollowTarget = FollowTarget.Get();
+	}
+	if (RegisteredAimTarget != TObjectKey<AActor>(AimTarget.Get()))
+	{
+		TargetSubsystem->UnregisterTarget(RegisteredAimTarget);
+		TargetSubsystem->RegisterTarget(AimTarget);
+		RegisteredAimTarget = AimTarget.Get();
+	}
+}
+
+void UECameraSettingsComponent::RefreshTickPrerequisites()
+{
+	for (const TWeakObjectPtr<AActor>& Actor : TickPrerequisiteActors)
+		if (Actor.IsValid()) RemoveTickPrerequisiteActor(Actor.Get());
+	for (const TWeakObjectPtr<UActorComponent>& Component : TickPrerequisiteComponents)
+		if (Component.IsValid()) RemoveTickPrerequisiteComponent(Component.Get());
+	TickPrerequisiteActors.Reset();
+	TickPrerequisiteComponents.Reset();
+
+	/** Tick groups before this component's have always completed when it ticks, so a prerequisite only matters for ticks in the same group or later. */
+	const ETickingGroup CameraTickGroup = PrimaryComponentTick.TickGroup.GetValue();
+	auto TicksWithOrAfterCamera = [CameraTickGroup](const FTickFunction& TickFunction)
+	{
+		return TickFunction.bCanEverTick && (TickFunction.TickGroup.GetValue() >= CameraTickGroup || TickFunction.EndTickGroup.GetValue() >= CameraTickGroup);
+	};
+
+	auto AddTargetPrerequisites = [this, &TicksWithOrAfterCamera](AActor* Target)
+	{
+		if (Target == nullptr || Target == GetOwner() || TickPrerequisiteActors.Contains(Target)) return;
+
+		if (TicksWithOrAfterCamera(Target->PrimaryActorTick))
+		{
+			AddTickPrerequisiteActor(Target);
+			TickPrerequisiteActors.Add(Target);
+		}
+
+		UMovementComponent* MovementComponent = Target->FindComponentByClass<UMovementComponent>();
+		if (MovementComponent != nullptr && TicksWithOrAfterCamera(MovementComponent->PrimaryComponentTick))
+		{
+			AddTickPrerequisiteComponent(MovementComponent);
+			TickPrerequisiteComponents.Add(MovementComponent);
+		}
+		USkeletalMeshComponent* MeshComponent = Target->FindComponentByClass<USkeletalMeshComponent>();
+		if (MeshComponent != nullptr && TicksWithOrAfterCamera(MeshComponent->PrimaryComponentTick))
+		{
+			AddTickPrerequisiteComponent(MeshComponent);
+			TickPrerequisiteComponents.Add(MeshComponent);
+		}
+	};
+	AddTargetPrerequisites(FollowTarget);
+	AddTargetPrerequisites(AimTarget);
 }
 
 void UECameraSettingsComponent::RegisterManager()
@@ -186,12 +311,12 @@ void UECameraSettingsComponent::InitializeECameraComponents()
 		if (Extension != nullptr) 
 			InitializeECameraComponent(Extension);
 
-	/** Special case: when you are using HardLockAim and uses the follow target's rotation, TickGroup should be set to TG_PrePhysics.
-	 *  This is because when you enable character's OrientRotationToMovement, the tick order would be CharacterLocation -> CameraRotation -> CharacterRotation,
-	 *	which creates strong camera jitter. Settings to TG_PrePhysics defers camera component to the next frame to mitigate this problem.
+	RefreshTargetRegistration();
+
+	/** Read targets after they have moved in current frame, if they tick as late as camera does.
+	 *  Targets and movement components in earlier tick groups, e.g., character movement in TG_PrePhysics, have always finished by then.
 	 */
-	if (AimComponent != nullptr && AimComponent->IsA<UHardLockAim>() && AimTarget == FollowTarget)
-		PrimaryComponentTick.TickGroup = TG_PrePhysics;
+	RefreshTickPrerequisites();
 }
 
 void UECameraSettingsComponent::InitializeECameraComponent(UECameraComponentBase* Component)
@@ -0,0 +1,117 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#include "Core/ECameraTargetSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+UECameraTargetSubsystem::UECameraTargetSubsystem()
+{
+	FilterTimeConstant = 0.05f;
+}
+
+void UECameraTargetSubsystem::RegisterTarget(AActor* Target)
+{
+	if (Target == nullptr) return;
+
+	if (int32* Index = TargetIndices.Find(Target))
+	{
+		++RefCounts[*Index];
+		return;
+	}
+
+	TargetIndices.Add(Target, Targets.Num());
+	TargetKeys.Add(Target);
+	Targets.Add(Target);
+	RefCounts.Add(1);
+	SampledFrames.Add(MAX_uint64);
+	SampledTimes.Add(0.0);
+	Positions.Add(Target->GetActorLocation());
+	Rotations.Add(Target->GetActorQuat());
+	Velocities.Add(Target->GetVelocity());
+	Accelerations.Add(FVector::ZeroVector);
+}
+
+void UECameraTargetSubsystem::UnregisterTarget(TObjectKey<AActor> TargetKey)
+{
+	if (int32* Index = TargetIndices.Find(TargetKey))
+	{
+		if (--RefCounts[*Index] <= 0) RemoveTargetAt(*Index);
+	}
+}
+
+FECameraTargetKinematics UECameraTargetSubsystem::GetKinematics(const AActor* Target)
+{
+	FECameraTargetKinematics Kinematics;
+	if (Target == nullptr) return Kinematics;
+
+	if (const int32* Index = TargetIndices.Find(Target))
+	{
+		SampleTarget(*Index);
+		Kinematics.Position = Positions[*Index];
+		Kinematics.Rotation = Rotations[*Index];
+		Kinematics.Velocity = Velocities[*Index];
+		Kinematics.Acceleration = Accelerations[*Index];
+	}
+	else
+	{
+		Kinematics.Position = Target->GetActorLocation();
+		Kinematics.Rotation = Target->GetActorQuat();
+		Kinematics.Velocity = Target->GetVelocity();
+	}
+	return Kinematics;
+}
+
+void UECameraTargetSubsystem::SampleTarget(int32 Index)
+{
+	if (SampledFrames[Index] == GFrameCounter) return;
+
+	const AActor* Target = Targets[Index].Get();
+	if (Target == nullptr) return;
+
+	const FVector Position = Target->GetActorLocation();
+	const double Time = GetWorld()->GetTimeSeconds();
+	const double DeltaSeconds = Time - SampledTimes[Index];
+
+	/** The first sample has no history, so seed velocity from the actor itself. */
+	if (SampledFrames[Index] == MAX_uint64)
+	{
+		Velocities[Index] = Target->GetVelocity();
+		Accelerations[Index] = FVector::ZeroVector;
+	}
+	/** Skip estimation when time does not advance, e.g., when the game is paused. */
+	else if (DeltaSeconds > UE_SMALL_NUMBER)
+	{
+		const double Alpha = FilterTimeConstant > 0.0f ? 1.0 - FMath::Exp(-DeltaSeconds / FilterTimeConstant) : 1.0;
+		const FVector RawVelocity = (Position - Positions[Index]) / DeltaSeconds;
+		const FVector Velocity = FMath::Lerp(Velocities[Index], RawVelocity, Alpha);
+		const FVector RawAcceleration = (Velocity - Velocities[Index]) / DeltaSeconds;
+		Accelerations[Index] = FMath::Lerp(Accelerations[Index], RawAcceleration, Alpha);
+		Velocities[Index] = Velocity;
+	}
+
+	Positions[Index] = Position;
+	Rotations[Index] = Target->GetActorQuat();
+	SampledTimes[Index] = Time;
+	SampledFrames[Index] = GFrameCounter;
+}
+
+void UECameraTargetSubsystem::RemoveTargetAt(int32 Index)
+{
+	TargetIndices.Remove(TargetKeys[Index]);
+
+	const int32 LastIndex = Targets.Num() - 1;
+	if (Index != LastIndex)
+	{
+		TargetIndices.Add(TargetKeys[LastIndex], Index);
+	}
+
+	TargetKeys.RemoveAtSwap(Index);
+	Targets.RemoveAtSwap(Index);
+	RefCounts.RemoveAtSwap(Index);
+	SampledFrames.RemoveAtSwap(Index);
+	SampledTimes.RemoveAtSwap(Index);
+	Positions.RemoveAtSwap(Index);
+	Rotations.RemoveAtSwap(Index);
+	Velocities.RemoveAtSwap(Index);
+	Accelerations.RemoveAtSwap(Index);
+}
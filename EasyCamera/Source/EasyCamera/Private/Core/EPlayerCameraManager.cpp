@@ -1,6 +1,8 @@
 // Copyright 2023 by Sulley. All Rights Reserved.
 
 #include "Core/EPlayerCameraManager.h"
+#include "Core/ECameraBase.h"
+#include "Core/ECameraSettingsComponent.h"
 #include "Camera/PlayerCameraManager.h"
 #include "Camera/CameraModifier_CameraShake.h"
 #include "WaveOscillatorCameraShakePattern.h"
@@ -101,6 +103,20 @@ void AEPlayerCameraManager::DoUpdateCamera(float DeltaTime)
 	}
 }
 
+void AEPlayerCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime)
+{
+	/** Camera actor's transform is read into POV by Super, so patching it here is enough. */
+	if (AECameraBase* Camera = Cast<AECameraBase>(OutVT.Target))
+	{
+		if (UECameraSettingsComponent* SettingsComponent = Camera->GetSettingsComponent())
+		{
+			SettingsComponent->LateUpdate(DeltaTime);
+		}
+	}
+
+	Super::UpdateViewTarget(OutVT, DeltaTime);
+}
+
 void AEPlayerCameraManager::AddBlendable(const TScriptInterface<IBlendableInterface>& InBlendableObject, const float InWeight)
 {
 	PostProcessMaterialSettings.AddBlendable(InBlendableObject, InWeight);
@@ -1,6 +1,7 @@
 // Copyright 2023 by Sulley. All Rights Reserved.
 
 #include "EasyCamera.h"
+#include "Utils/ECameraLookInputProcessor.h"
 
 #define LOCTEXT_NAMESPACE "FEasyCameraModule"
 
@@ -13,6 +14,7 @@ void FEasyCameraModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FECameraLookInputProcessor::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -9,7 +9,14 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "DrawDebugHelpers.h"
+#include "Camera/CameraComponent.h"
+#include "Curves/CurveFloat.h"
 #include "PhysicsEngine/PhysicsSettings.h"
+#include "Components/PrimitiveComponent.h"
+#include "EasyCamera.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deoccluder Trace Cache Hits"), STAT_DeoccluderTraceCacheHits, STATGROUP_EasyCamera);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deoccluder Trace Cache Misses"), STAT_DeoccluderTraceCacheMisses, STATGROUP_EasyCamera);
 
 UDeoccluderExtension::UDeoccluderExtension()
 {
@@ -21,11 +28,33 @@ UDeoccluderExtension::UDeoccluderExtension()
 	CameraDistanceFromOcclusion = 0.0f;
 	OcclusionDamping = 0.0f;
 	RestoreDamping = 0.0f;
+	bUseWhiskers = false;
+	bCornerWhiskers = true;
+	CornerWhiskerDepth = 10.0f;
+	NumSideWhiskers = 2;
+	SideWhiskerAngle = 15.0f;
+	SideWhiskerBudget = 2;
+	WhiskerPushInCurve = nullptr;
 
 	OcclusionElapsedTime = 0.0f;
 	CachedRawLocation = FVector(0, 0, 0);
 	DeltaDistanceFromCamera = 0.0f;
 	AlreadyDampedTime = 0.0f;
+	PendingTraceStart = FVector(0, 0, 0);
+	PendingTraceEnd = FVector(0, 0, 0);
+	bForceSyncTrace = true;
+	NextSideWhisker = 0;
+	bTraceCacheValid = false;
+	CachedTraceStart = FVector(0, 0, 0);
+	CachedTraceEnd = FVector(0, 0, 0);
+	CachedTraceShape = ETraceShape::Line;
+	CachedTraceRadius = 0.0f;
+	CachedTraceTime = 0.0;
+	NumTraceQueries = 0;
+	NumTraceCacheHits = 0;
+	bWhiskersInTraceCache = false;
+	CachedWhiskerFraction = 1.0f;
+	CachedWhiskerFieldOfView = 0.0f;
 }
 
 void UDeoccluderExtension::UpdateComponent_Implementation(float DeltaTime)
@@ -58,34 +87,68 @@ void UDeoccluderExtension::UpdateComponent_Implementation(float DeltaTime)
 		return;
 	}
 
-	/** Find list of hits. */
-	TArray<FHitResult> OutHits;
-	if (OccluderParams.bTraceSingle)
+	/** Find list of hits. A cached clear trace is reused, and in async mode last frame's hits are used unless the sight line has jumped. */
+	TArray<FHitResult>& OutHits = HitResults;
+	const bool bSightLineJumped = bForceSyncTrace || (OccluderParams.bAsyncTrace && HasSightLineJumped(Start, End));
+	const bool bTraceCached = OccluderParams.bCacheClearTrace && !bForceSyncTrace && IsTraceCacheValid(Start, End) && AreWhiskersCached();
+	if (bTraceCached)
 	{
-		FHitResult OutHit;
-		bool bHit;
-		if (OccluderParams.TraceShape == ETraceShape::Line)
+		/** Whiskers were traced along with the cached sight line, so their traces are skipped as well. */
+		const int32 NumSkippedTraces = 1 + (bUseWhiskers ? GetNumRefreshedWhiskers() : 0);
+		NumTraceQueries += NumSkippedTraces;
+		NumTraceCacheHits += NumSkippedTraces;
+		INC_DWORD_STAT_BY(STAT_DeoccluderTraceCacheHits, NumSkippedTraces);
+		OutHits.Reset();
+
+		/** Nothing is submitted meanwhile, so the next traces after the cache expires are synchronous. */
+		PendingTraceHandle = FTraceHandle();
+		PendingWhiskerHandles.Reset();
+		PendingWhiskerIndices.Reset();
+
+		/** Whiskers are merged into the hits as a virtual hit on the sight line, so that they share all the rules below. */
+		if (bUseWhiskers && CachedWhiskerFraction < 1.0f) AddWhiskerHit(Start, End, CachedWhiskerFraction);
+	}
+	else
+	{
+		++NumTraceQueries;
+		if (OccluderParams.bCacheClearTrace) INC_DWORD_STAT(STAT_DeoccluderTraceCacheMisses);
+
+		const bool bConsumedAsyncTrace = OccluderParams.bAsyncTrace && !bSightLineJumped && ConsumeAsyncTrace(Start, End);
+		bool bTracedSync = !bConsumedAsyncTrace;
+
+		/** Only a synchronous result is cached. Last frame's async result predates the mover snapshot taken now, so a mover that slid into the sight line meanwhile would be recorded in its blocking pose.
+		 *  So once an async trace comes back clear and the sight line has stayed within tolerance since, confirm it synchronously to seed the cache.
+		 */
+		if (bConsumedAsyncTrace && OccluderParams.bCacheClearTrace && OutHits.IsEmpty())
 		{
-			bHit = UKismetSystemLibrary::LineTraceSingleForObjects(GetWorld(), Start, End, OccluderParams.ObjectTypes, false, OccluderParams.ActorsToIgnore, OccluderParams.bShowDebug ? EDrawDebugTrace::Type::ForOneFrame : EDrawDebugTrace::Type::None, OutHit, true);
+			const double MaxSquaredShift = FMath::Square(OccluderParams.TraceCacheTolerance);
+			bTracedSync = FVector::DistSquared(Start, PendingTraceStart) <= MaxSquaredShift && FVector::DistSquared(End, PendingTraceEnd) <= MaxSquaredShift;
 		}
-		else if (OccluderParams.TraceShape == ETraceShape::Sphere)
+		if (bTracedSync)
 		{
-			bHit = UKismetSystemLibrary::SphereTraceSingleForObjects(GetWorld(), Start, End, OccluderParams.SphereRadius, OccluderParams.ObjectTypes, false, OccluderParams.ActorsToIgnore, OccluderParams.bShowDebug ? EDrawDebugTrace::Type::ForOneFrame : EDrawDebugTrace::Type::None, OutHit, true);
+			TraceSync(Start, End);
 		}
-		else bHit = false;
-		if (bHit) OutHits.Add(OutHit);
-	}
-	else
-	{
-		if (OccluderParams.TraceShape == ETraceShape::Line)
+
+		if (OccluderParams.bAsyncTrace)
 		{
-			UKismetSystemLibrary::LineTraceMultiForObjects(GetWorld(), Start, End, OccluderParams.ObjectTypes, false, OccluderParams.ActorsToIgnore, OccluderParams.bShowDebug ? EDrawDebugTrace::Type::ForOneFrame : EDrawDebugTrace::Type::None, OutHits, true);
+			SubmitAsyncTrace(Start, End);
 		}
-		else if (OccluderParams.TraceShape == ETraceShape::Sphere)
+
+		const bool bBuildTraceCache = OccluderParams.bCacheClearTrace && bTracedSync && OutHits.IsEmpty();
+
+		/** Whiskers are merged into the hits as a virtual hit on the sight line, so that they share all the rules below.
+		 *  The cache stands for whiskers as well, so when it is built, all of them are traced synchronously along with the sight line.
+		 */
+		if (bUseWhiskers)
 		{
-			UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), Start, End, OccluderParams.SphereRadius, OccluderParams.ObjectTypes, false, OccluderParams.ActorsToIgnore, OccluderParams.bShowDebug ? EDrawDebugTrace::Type::ForOneFrame : EDrawDebugTrace::Type::None, OutHits, true);
+			CachedWhiskerFraction = UpdateWhiskers(Start, End, OccluderParams.bAsyncTrace && !bSightLineJumped && !bBuildTraceCache, bSightLineJumped, bBuildTraceCache);
+			if (CachedWhiskerFraction < 1.0f) AddWhiskerHit(Start, End, CachedWhiskerFraction);
 		}
+
+		if (bBuildTraceCache) BuildTraceCache(Start, End, Target);
+		else InvalidateTraceCache();
 	}
+	bForceSyncTrace = false;
 	
 	/** Resolve occlusion when result hits are not empty. */
 	if (!OutHits.IsEmpty())
@@ -183,4 +246,309 @@ void UDeoccluderExtension::ResetVariablesAndRestoreDamping(float DeltaTime, cons
 void UDeoccluderExtension::BindToOnPreTickComponent()
 {
 	if (GetOwningActor() != nullptr) GetOwningActor()->SetActorLocation(CachedRawLocation);
-}
\ No newline at end of file
+}
+
+void UDeoccluderExtension::ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserveState)
+{
+	PendingTraceHandle = FTraceHandle();
+	bForceSyncTrace = true;
+	InvalidateTraceCache();
+	NumTraceQueries = 0;
+	NumTraceCacheHits = 0;
+}
+
+void UDeoccluderExtension::TraceSync(const FVector& Start, const FVector& End)
+{
+	TArray<FHitResult>& OutHits = HitResults;
+	OutHits.Reset();
+	if (OccluderParams.bTraceSingle)
+	{
+		FHitResult OutHit;
+		bool bHit;
+		if (OccluderParams.TraceShape == ETraceShape::Line)
+		{
+			bHit = UKismetSystemLibrary::LineTraceSingleForObjects(GetWorld(), Start, End, OccluderParams.ObjectTypes, false, OccluderParams.ActorsToIgnore, OccluderParams.bShowDebug ? EDrawDebugTrace::Type::ForOneFrame : EDrawDebugTrace::Type::None, OutHit, true);
+		}
+		else if (OccluderParams.TraceShape == ETraceShape::Sphere)
+		{
+			bHit = UKismetSystemLibrary::SphereTraceSingleForObjects(GetWorld(), Start, End, OccluderParams.SphereRadius, OccluderParams.ObjectTypes, false, OccluderParams.ActorsToIgnore, OccluderParams.bShowDebug ? EDrawDebugTrace::Type::ForOneFrame : EDrawDebugTrace::Type::None, OutHit, true);
+		}
+		else bHit = false;
+		if (bHit) OutHits.Add(OutHit);
+	}
+	else
+	{
+		if (OccluderParams.TraceShape == ETraceShape::Line)
+		{
+			UKismetSystemLibrary::LineTraceMultiForObjects(GetWorld(), Start, End, OccluderParams.ObjectTypes, false, OccluderParams.ActorsToIgnore, OccluderParams.bShowDebug ? EDrawDebugTrace::Type::ForOneFrame : EDrawDebugTrace::Type::None, OutHits, true);
+		}
+		else if (OccluderParams.TraceShape == ETraceShape::Sphere)
+		{
+			UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), Start, End, OccluderParams.SphereRadius, OccluderParams.ObjectTypes, false, OccluderParams.ActorsToIgnore, OccluderParams.bShowDebug ? EDrawDebugTrace::Type::ForOneFrame : EDrawDebugTrace::Type::None, OutHits, true);
+		}
+	}
+}
+
+void UDeoccluderExtension::SubmitAsyncTrace(const FVector& Start, const FVector& End)
+{
+	const EAsyncTraceType TraceType = OccluderParams.bTraceSingle ? EAsyncTraceType::Single : EAsyncTraceType::Multi;
+	const FCollisionObjectQueryParams ObjectQueryParams(OccluderParams.ObjectTypes);
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DeoccluderAsyncTrace), false);
+	QueryParams.AddIgnoredActors(OccluderParams.ActorsToIgnore);
+
+	if (OccluderParams.TraceShape == ETraceShape::Sphere)
+	{
+		PendingTraceHandle = GetWorld()->AsyncSweepByObjectType(TraceType, Start, End, FQuat::Identity, ObjectQueryParams, FCollisionShape::MakeSphere(OccluderParams.SphereRadius), QueryParams);
+	}
+	else
+	{
+		PendingTraceHandle = GetWorld()->AsyncLineTraceByObjectType(TraceType, Start, End, ObjectQueryParams, QueryParams);
+	}
+	PendingTraceStart = Start;
+	PendingTraceEnd = End;
+
+	if (OccluderParams.bShowDebug) DrawDebugLine(GetWorld(), Start, End, FColor::Red);
+}
+
+bool UDeoccluderExtension::ConsumeAsyncTrace(const FVector& Start, const FVector& End)
+{
+	if (bForceSyncTrace || !PendingTraceHandle.IsValid()) return false;
+
+	/** A cut or teleport makes last frame's hits meaningless for current sight line. */
+	if (HasSightLineJumped(Start, End)) return false;
+
+	/** Result is only available in the frame after submission, so a skipped frame also falls back. */
+	FTraceDatum TraceDatum;
+	if (!GetWorld()->QueryTraceData(PendingTraceHandle, TraceDatum)) return false;
+
+	/** Keep each hit at the same distance from target along current sight line. Hits beyond the camera no longer occlude it. */
+	const FVector Direction = (End - Start).GetSafeNormal();
+	const double Length = FVector::Distance(Start, End);
+
+	TArray<FHitResult>& OutHits = HitResults;
+	OutHits.Reset();
+	for (FHitResult& Hit : TraceDatum.OutHits)
+	{
+		if (Hit.Distance > Length) continue;
+		Hit.Location = Start + Hit.Distance * Direction;
+		OutHits.Add(MoveTemp(Hit));
+	}
+	return true;
+}
+
+bool UDeoccluderExtension::HasSightLineJumped(const FVector& Start, const FVector& End) const
+{
+	const double MaxSquaredShift = FMath::Square(OccluderParams.AsyncFallbackDistance);
+	return FVector::DistSquared(Start, PendingTraceStart) > MaxSquaredShift || FVector::DistSquared(End, PendingTraceEnd) > MaxSquaredShift;
+}
+
+bool UDeoccluderExtension::IsTraceCacheValid(const FVector& Start, const FVector& End) const
+{
+	if (!bTraceCacheValid) return false;
+
+	/** Both ends must stay close, with the same trace shape. */
+	const double MaxSquaredShift = FMath::Square(OccluderParams.TraceCacheTolerance);
+	if (FVector::DistSquared(Start, CachedTraceStart) > MaxSquaredShift || FVector::DistSquared(End, CachedTraceEnd) > MaxSquaredShift) return false;
+	if (OccluderParams.TraceShape != CachedTraceShape) return false;
+	if (OccluderParams.TraceShape == ETraceShape::Sphere && OccluderParams.SphereRadius != CachedTraceRadius) return false;
+	if (GetWorld()->GetTimeSeconds() - CachedTraceTime > OccluderParams.TraceCacheMaxAge) return false;
+
+	/** Any watched primitive that moved or was destroyed may have changed the result. */
+	for (int32 Index = 0; Index < CachedMovers.Num(); ++Index)
+	{
+		const UPrimitiveComponent* Mover = CachedMovers[Index].Get();
+		if (Mover == nullptr || !Mover->GetComponentTransform().Equals(CachedMoverTransforms[Index])) return false;
+	}
+	return true;
+}
+
+void UDeoccluderExtension::BuildTraceCache(const FVector& Start, const FVector& End, AActor* Target)
+{
+	InvalidateTraceCache();
+
+	bTraceCacheValid = true;
+	CachedTraceStart = Start;
+	CachedTraceEnd = End;
+	CachedTraceShape = OccluderParams.TraceShape;
+	CachedTraceRadius = OccluderParams.SphereRadius;
+	CachedTraceTime = GetWorld()->GetTimeSeconds();
+	bWhiskersInTraceCache = bUseWhiskers;
+	CachedWhiskerFieldOfView = GetCameraComponent()->FieldOfView;
+
+	/** Watch movable primitives within a capsule around the sight line, which covers every trace the cache stands for. */
+	const FVector Segment = End - Start;
+	const double Radius = (OccluderParams.TraceShape == ETraceShape::Sphere ? OccluderParams.SphereRadius : 0.0) + OccluderParams.TraceCacheTolerance + UE_KINDA_SMALL_NUMBER;
+	FCollisionShape WatchShape = FCollisionShape::MakeCapsule(Radius, Segment.Size() * 0.5 + Radius);
+	FQuat WatchRotation = FRotationMatrix::MakeFromZ(Segment).ToQuat();
+	FVector WatchCenter = Start + Segment * 0.5;
+
+	/** Whisker rays fan out of the capsule, so watch a box enclosing all of them instead. */
+	if (bUseWhiskers)
+	{
+		FBox WatchBox(ForceInit);
+		WatchBox += Start;
+		WatchBox += End;
+		for (int32 Index = 0; Index < WhiskerFractions.Num(); ++Index) WatchBox += GetWhiskerEnd(Index, Start, End);
+		WatchBox = WatchBox.ExpandBy(Radius);
+		WatchShape = FCollisionShape::MakeBox(WatchBox.GetExtent());
+		WatchRotation = FQuat::Identity;
+		WatchCenter = WatchBox.GetCenter();
+	}
+
+	const FCollisionObjectQueryParams ObjectQueryParams(OccluderParams.ObjectTypes);
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DeoccluderTraceCache), false);
+	QueryParams.AddIgnoredActors(OccluderParams.ActorsToIgnore);
+	QueryParams.AddIgnoredActor(Target);
+	QueryParams.AddIgnoredActor(GetOwningActor());
+
+	TArray<FOverlapResult> Overlaps;
+	GetWorld()->OverlapMultiByObjectType(Overlaps, WatchCenter, WatchRotation, ObjectQueryParams, WatchShape, QueryParams);
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		UPrimitiveComponent* Component = Overlap.GetComponent();
+		if (Component == nullptr || Component->Mobility != EComponentMobility::Movable) continue;
+		CachedMovers.Add(Component);
+		CachedMoverTransforms.Add(Component->GetComponentTransform());
+	}
+}
+
+bool UDeoccluderExtension::AreWhiskersCached()
+{
+	if (!bUseWhiskers) return true;
+
+	/** Corner whiskers depend on field of view, and a changed layout has no cached results. */
+	const int32 NumWhiskers = (bCornerWhiskers ? 4 : 0) + 2 * NumSideWhiskers;
+	return bWhiskersInTraceCache && WhiskerFractions.Num() == NumWhiskers && GetCameraComponent()->FieldOfView == CachedWhiskerFieldOfView;
+}
+
+int32 UDeoccluderExtension::GetNumRefreshedWhiskers() const
+{
+	return (bCornerWhiskers ? 4 : 0) + FMath::Min(SideWhiskerBudget, 2 * NumSideWhiskers);
+}
+
+float UDeoccluderExtension::UpdateWhiskers(const FVector& Start, const FVector& End, bool bAsync, bool bDiscard, bool bRefreshAll)
+{
+	const int32 NumCornerWhiskers = bCornerWhiskers ? 4 : 0;
+	const int32 NumSides = 2 * NumSideWhiskers;
+	const int32 NumWhiskers = NumCornerWhiskers + NumSides;
+	if (NumWhiskers == 0) return 1.0f;
+
+	/** Results belonging to another camera state or whisker layout are dropped. */
+	if (bDiscard || WhiskerFractions.Num() != NumWhiskers)
+	{
+		WhiskerFractions.Init(1.0f, NumWhiskers);
+		PendingWhiskerHandles.Reset();
+		PendingWhiskerIndices.Reset();
+	}
+
+	/** Read whiskers submitted last frame. Penetrating hits are ignored, as the sight line does. */
+	if (bAsync)
+	{
+		for (int32 Index = 0; Index < PendingWhiskerHandles.Num(); ++Index)
+		{
+			FTraceDatum TraceDatum;
+			if (GetWorld()->QueryTraceData(PendingWhiskerHandles[Index], TraceDatum))
+			{
+				const bool bHit = !TraceDatum.OutHits.IsEmpty() && !TraceDatum.OutHits[0].bStartPenetrating;
+				WhiskerFractions[PendingWhiskerIndices[Index]] = bHit ? TraceDatum.OutHits[0].Time : 1.0f;
+			}
+		}
+	}
+	PendingWhiskerHandles.Reset();
+	PendingWhiskerIndices.Reset();
+
+	/** Corner whiskers are refreshed every frame, while side feelers take turns within the budget. */
+	TArray<int32, TInlineAllocator<24>> RefreshedIndices;
+	for (int32 Index = 0; Index < NumCornerWhiskers; ++Index) RefreshedIndices.Add(Index);
+	const int32 NumRefreshedSides = bRefreshAll ? NumSides : FMath::Min(SideWhiskerBudget, NumSides);
+	for (int32 Count = 0; Count < NumRefreshedSides; ++Count)
+	{
+		NextSideWhisker %= NumSides;
+		RefreshedIndices.Add(NumCornerWhiskers + NextSideWhisker);
+		++NextSideWhisker;
+	}
+
+	/** Whisker traces count as sight line traces do, so the hit rate covers every trace the cache can skip. */
+	NumTraceQueries += RefreshedIndices.Num();
+	if (OccluderParams.bCacheClearTrace) INC_DWORD_STAT_BY(STAT_DeoccluderTraceCacheMisses, RefreshedIndices.Num());
+
+	/** All whiskers go into the same async trace batch as the sight line. */
+	const FCollisionObjectQueryParams ObjectQueryParams(OccluderParams.ObjectTypes);
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DeoccluderWhiskerTrace), false);
+	QueryParams.AddIgnoredActors(OccluderParams.ActorsToIgnore);
+
+	for (int32 Index : RefreshedIndices)
+	{
+		const FVector WhiskerEnd = GetWhiskerEnd(Index, Start, End);
+		if (bAsync)
+		{
+			PendingWhiskerHandles.Add(GetWorld()->AsyncLineTraceByObjectType(EAsyncTraceType::Single, Start, WhiskerEnd, ObjectQueryParams, QueryParams));
+			PendingWhiskerIndices.Add(Index);
+		}
+		else
+		{
+			FHitResult Hit;
+			const bool bHit = GetWorld()->LineTraceSingleByObjectType(Hit, Start, WhiskerEnd, ObjectQueryParams, QueryParams) && !Hit.bStartPenetrating;
+			WhiskerFractions[Index] = bHit ? Hit.Time : 1.0f;
+		}
+
+		if (OccluderParams.bShowDebug) DrawDebugLine(GetWorld(), Start, WhiskerEnd, WhiskerFractions[Index] < 1.0f ? FColor::Orange : FColor::Yellow);
+	}
+
+	/** A whisker hit at fraction F of its ray pushes camera in to 1 - (1 - F) * Weight of the sight line. The strongest push wins. */
+	float Fraction = 1.0f;
+	for (int32 Index = 0; Index < NumWhiskers; ++Index)
+	{
+		Fraction = FMath::Min(Fraction, 1.0f - (1.0f - WhiskerFractions[Index]) * GetWhiskerPushInWeight(Index));
+	}
+	return Fraction;
+}
+
+FVector UDeoccluderExtension::GetWhiskerEnd(int32 Index, const FVector& Start, const FVector& End)
+{
+	const FECameraFrame& Frame = GetCameraFrame();
+	const int32 NumCornerWhiskers = bCornerWhiskers ? 4 : 0;
+
+	/** Corner whiskers end at the near plane corners in front of camera. */
+	if (Index < NumCornerWhiskers)
+	{
+		const double HalfWidth = CornerWhiskerDepth * FMath::Tan(FMath::DegreesToRadians(GetCameraComponent()->FieldOfView * 0.5));
+		const double HalfHeight = HalfWidth / GetCameraComponent()->AspectRatio;
+		const double SignRight = (Index & 1) ? 1.0 : -1.0;
+		const double SignUp = (Index & 2) ? 1.0 : -1.0;
+		return End + Frame.Forward * CornerWhiskerDepth + Frame.Right * (SignRight * HalfWidth) + Frame.Up * (SignUp * HalfHeight);
+	}
+
+	/** Side feelers keep the length of the sight line, fanning out evenly to SideWhiskerAngle on either side. */
+	const int32 SideIndex = Index - NumCornerWhiskers;
+	const double Sign = SideIndex < NumSideWhiskers ? -1.0 : 1.0;
+	const double Angle = Sign * SideWhiskerAngle * (SideIndex % NumSideWhiskers + 1) / NumSideWhiskers;
+	return Start + FQuat(Frame.Up, FMath::DegreesToRadians(Angle)).RotateVector(End - Start);
+}
+
+float UDeoccluderExtension::GetWhiskerPushInWeight(int32 Index) const
+{
+	const int32 NumCornerWhiskers = bCornerWhiskers ? 4 : 0;
+	if (Index < NumCornerWhiskers) return 1.0f;
+
+	const float NormalizedAngle = float((Index - NumCornerWhiskers) % NumSideWhiskers + 1) / NumSideWhiskers;
+	if (WhiskerPushInCurve != nullptr) return FMath::Clamp(WhiskerPushInCurve->GetFloatValue(NormalizedAngle), 0.0f, 1.0f);
+	return 1.0f - 0.5f * NormalizedAngle;
+}
+
+void UDeoccluderExtension::AddWhiskerHit(const FVector& Start, const FVector& End, float Fraction)
+{
+	FHitResult WhiskerHit;
+	WhiskerHit.bBlockingHit = true;
+	WhiskerHit.Time = Fraction;
+	WhiskerHit.TraceStart = Start;
+	WhiskerHit.TraceEnd = End;
+	WhiskerHit.Location = FMath::Lerp(Start, End, Fraction);
+	WhiskerHit.ImpactPoint = WhiskerHit.Location;
+	WhiskerHit.Distance = Fraction * FVector::Distance(Start, End);
+
+	/** A penetrating first hit is always skipped when resolving, so never insert before it. */
+	int32 InsertIndex = (!HitResults.IsEmpty() && HitResults[0].bStartPenetrating) ? 1 : 0;
+	while (InsertIndex < HitResults.Num() && HitResults[InsertIndex].Distance <= WhiskerHit.Distance) ++InsertIndex;
+	HitResults.Insert(WhiskerHit, InsertIndex);
+}
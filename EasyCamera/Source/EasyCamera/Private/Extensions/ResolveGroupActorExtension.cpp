@@ -5,6 +5,7 @@
 #include "Utils/ECameraLibrary.h"
 #include "Utils/ECameraGroupActorComponent.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Misc/MemStack.h"
 
 UResolveGroupActorExtension::UResolveGroupActorExtension()
 {
@@ -23,80 +24,144 @@ void UResolveGroupActorExtension::UpdateComponent_Implementation(float DeltaTime
 	AECameraGroupActor* FollowGroupActor = Cast<AECameraGroupActor>(GetOwningSettingComponent()->GetFollowTarget());
 	AECameraGroupActor* AimGroupActor = Cast<AECameraGroupActor>(GetOwningSettingComponent()->GetAimTarget());
 
-	TArray<FBoundingWrappedActor> TargetActorsRef;
-	if (FollowGroupActor) TargetActorsRef.Append(FollowGroupActor->CameraGroupActorComponent->TargetActors);
-	if (AimGroupActor) TargetActorsRef.Append(AimGroupActor->CameraGroupActorComponent->TargetActors);
-	if (TargetActorsRef.Num() != 0) ResolveGroupActor(TargetActorsRef, DeltaTime);
+	/** Groups are read in place, so that their cached member bounds can be used. */
+	TArray<UECameraGroupActorComponent*, TInlineAllocator<2>> Groups;
+	int32 NumTargetActors = 0;
+	if (FollowGroupActor)
+	{
+		Groups.Add(FollowGroupActor->CameraGroupActorComponent);
+		NumTargetActors += FollowGroupActor->CameraGroupActorComponent->TargetActors.Num();
+	}
+	if (AimGroupActor && AimGroupActor != FollowGroupActor)
+	{
+		Groups.Add(AimGroupActor->CameraGroupActorComponent);
+		NumTargetActors += AimGroupActor->CameraGroupActorComponent->TargetActors.Num();
+	}
+
+	if (NumTargetActors != 0) ResolveGroupActor(Groups, DeltaTime);
 }
 
-void UResolveGroupActorExtension::ResolveGroupActor(TArray<FBoundingWrappedActor> TargetActors, float DeltaTime)
+void UResolveGroupActorExtension::ResolveGroupActor(TArrayView<UECameraGroupActorComponent* const> Groups, float DeltaTime)
 {
+	/** Apply already adjusted distance at the very beginning, so that targets are measured from the undisplaced camera. */
+	if (ResolveMethod != EResolveGroupActorMethod::ZoomOnly)
+		GetOwningActor()->AddActorLocalOffset(FVector(AdjustedDistance, 0, 0));
+
+	/** Camera does not move again before both FOV and distance are solved, so targets are transformed only once. */
+	TArray<double, TMemStackAllocator<>> Depths;
+	TArray<double, TMemStackAllocator<>> Extents;
+	const double MaxExtentRatio = GatherTargetExtents(Groups, Depths, Extents);
+
 	if (ResolveMethod == EResolveGroupActorMethod::ZoomOnly)
 	{
-		float ResultDeltaFOV = GetFOVForZoomOnly(TargetActors, DeltaTime);
+		float ResultDeltaFOV = GetDeltaFOV(MaxExtentRatio, DeltaTime);
 		GetCameraComponent()->FieldOfView += ResultDeltaFOV;
 		return;
 	}
 	else if (ResolveMethod == EResolveGroupActorMethod::DistanceOnly)
 	{
-		/** Should first apply already adjusted distance. */
-		GetOwningActor()->AddActorLocalOffset(FVector(AdjustedDistance, 0, 0));
-		float ResultDeltaDistance = GetDistanceForDistanceOnly(TargetActors, DeltaTime, GetCameraComponent()->FieldOfView);
-		/** Then apply delta distance. */
+		float ResultDeltaDistance = GetDeltaDistance(Depths, Extents, GetCameraComponent()->FieldOfView, DeltaTime);
 		GetOwningActor()->AddActorLocalOffset(FVector(ResultDeltaDistance, 0, 0));
 		return;
 	}
 	else if (ResolveMethod == EResolveGroupActorMethod::Mix)
 	{
-		/** Apply already adjusted distance at the very beginning. */
-		GetOwningActor()->AddActorLocalOffset(FVector(AdjustedDistance, 0, 0));
-
-		/** Then, get and apply result delat FOV. */
-		float ResultDeltaFOV = GetFOVForZoomOnly(TargetActors, DeltaTime);
+		/** First, get and apply result delat FOV. */
+		float ResultDeltaFOV = GetDeltaFOV(MaxExtentRatio, DeltaTime);
 		GetCameraComponent()->FieldOfView += ResultDeltaFOV;
 
-		/** Next to check if FOV is nearly at the range bounds. If so, adjust distance. */
-		if ((UKismetMathLibrary::NearlyEqual_FloatFloat(GetCameraComponent()->FieldOfView, FOVRange.Y, 1)
-			|| UKismetMathLibrary::NearlyEqual_FloatFloat(GetCameraComponent()->FieldOfView, FOVRange.X, 1)))
+		/** Adjust distance if FOV is nearly at the range bounds, or else try to adjust distance back to zero. */
+		const float FOV = GetCameraComponent()->FieldOfView;
+		const bool bFOVAtBounds = FMath::IsNearlyEqual(FOV, FOVRange.Y, 1.0f) || FMath::IsNearlyEqual(FOV, FOVRange.X, 1.0f);
+		if (bFOVAtBounds || !FMath::IsNearlyEqual(AdjustedDistance, 0.0f, 1.0f))
 		{
-			float ResultDeltaDistance = GetDistanceForDistanceOnly(TargetActors, DeltaTime, GetCameraComponent()->FieldOfView);
+			float ResultDeltaDistance = GetDeltaDistance(Depths, Extents, FOV, DeltaTime);
 			GetOwningActor()->AddActorLocalOffset(FVector(ResultDeltaDistance, 0, 0));
 		}
-		/** Else, try to first adjust distance back to zero. */
-		else
-		{
-			if (!UKismetMathLibrary::NearlyEqual_FloatFloat(AdjustedDistance, 0, 1))
-			{
-				float ResultDeltaDistance = GetDistanceForDistanceOnly(TargetActors, DeltaTime, GetCameraComponent()->FieldOfView);
-				GetOwningActor()->AddActorLocalOffset(FVector(ResultDeltaDistance, 0, 0));
-			}
-		}
 		return;
 	}
 }
 
-float UResolveGroupActorExtension::GetFOVForZoomOnly(TArray<FBoundingWrappedActor> TargetActors, float DeltaTime)
+double UResolveGroupActorExtension::GatherTargetExtents(TArrayView<UECameraGroupActorComponent* const> Groups, TArray<double, TMemStackAllocator<>>& OutDepths, TArray<double, TMemStackAllocator<>>& OutExtents)
 {
-	/** Required FOV, a minimum value of DefaultFOV. */
-	float RequiredFOV = FOVRange.X;
-	for (FBoundingWrappedActor& BWActor : TargetActors)
+	OutDepths.Reset();
+	OutExtents.Reset();
+
+	/** Camera may have been moved by this extension, so build the frame once here and reuse it for all targets. */
+	const FECameraFrame Frame = UECameraLibrary::MakeCameraFrame(GetOwningActor());
+	const double Scale = 1.0 - Tolerance;
+	const double AspectRatio = GetCameraComponent()->AspectRatio;
+
+	/** A sphere touches a frustum side plane at its radius times the secant of that side's half angle. Current FOV is used, which converges as FOV is damped. */
+	const double TanHalfFOV = FMath::Tan(FMath::DegreesToRadians(GetCameraComponent()->FieldOfView * 0.5));
+	const double HorizontalSecant = FMath::Sqrt(1.0 + FMath::Square(TanHalfFOV));
+	const double VerticalSecant = FMath::Sqrt(1.0 + FMath::Square(TanHalfFOV / AspectRatio));
+
+	double MaxExtentRatio = 0.0;
+
+	/** Vertical extent is scaled by aspect ratio, so that both axes are compared against the horizontal FOV. Only points in front of camera are considered. */
+	auto AddExtent = [&](double Depth, double HorizontalExtent, double VerticalExtent)
+	{
+		if (Depth <= 0) return;
+		const double Extent = FMath::Max(HorizontalExtent, VerticalExtent * AspectRatio) * Scale;
+		OutDepths.Add(Depth);
+		OutExtents.Add(Extent);
+		MaxExtentRatio = FMath::Max(MaxExtentRatio, Extent / Depth);
+	};
+
+	for (UECameraGroupActorComponent* Group : Groups)
 	{
-		FVector LocalSpacePosition = UECameraLibrary::GetLocalSpacePosition(GetOwningActor(), BWActor.Target->GetActorLocation());
-		/** Only consider targets in front of camera. */
-		if (LocalSpacePosition.X > 0 && !BWActor.bExcludeBoundingBox)
+		Group->EnsureRefreshed();
+		const TArray<FBoundingWrappedActor>& TargetActors = Group->TargetActors;
+		OutDepths.Reserve(OutDepths.Num() + TargetActors.Num());
+		OutExtents.Reserve(OutExtents.Num() + TargetActors.Num());
+
+		for (int32 Index = 0; Index < TargetActors.Num(); ++Index)
 		{
-			float RightBound = (LocalSpacePosition.Y + BWActor.Width) * (1 - Tolerance);
-			float LeftBound = (LocalSpacePosition.Y - BWActor.Width) * (1 - Tolerance);
-			float TopBound = (LocalSpacePosition.Z + BWActor.Height) * (1 - Tolerance);
-			float BottomBound = (LocalSpacePosition.Z - BWActor.Height) * (1 - Tolerance);
-
-			if (RightBound > 0) RequiredFOV = FMath::Max(RequiredFOV, 2 * UKismetMathLibrary::DegAtan(RightBound / LocalSpacePosition.X));
-			if (LeftBound < 0) RequiredFOV = FMath::Max(RequiredFOV, 2 * UKismetMathLibrary::DegAtan(-LeftBound / LocalSpacePosition.X));
-			if (TopBound > 0) RequiredFOV = FMath::Max(RequiredFOV, 2 * UKismetMathLibrary::DegAtan(TopBound / LocalSpacePosition.X * GetCameraComponent()->AspectRatio));
-			if (BottomBound < 0) RequiredFOV = FMath::Max(RequiredFOV, 2 * UKismetMathLibrary::DegAtan(-BottomBound / LocalSpacePosition.X * GetCameraComponent()->AspectRatio));
+			const FBoundingWrappedActor& BWActor = TargetActors[Index];
+			if (BWActor.Target == nullptr || BWActor.bExcludeBoundingBox) continue;
+
+			const FBox LocalBounds = BWActor.Shape != EBoundingShape::ScreenBox ? Group->GetMemberLocalBounds(BWActor.Target) : FBox(ForceInit);
+
+			/** Actors without primitive components fall back to the screen box. */
+			if (!LocalBounds.IsValid)
+			{
+				/** The farther of the two box edges on each axis decides, which is |center| plus half size. */
+				const FVector LocalSpacePosition = Frame.ToLocal(BWActor.Target->GetActorLocation());
+				AddExtent(LocalSpacePosition.X, FMath::Abs(LocalSpacePosition.Y) + BWActor.Width, FMath::Abs(LocalSpacePosition.Z) + BWActor.Height);
+			}
+			else if (BWActor.Shape == EBoundingShape::Sphere)
+			{
+				const FTransform& ActorTransform = BWActor.Target->GetActorTransform();
+				const FVector LocalSpaceCenter = Frame.ToLocal(ActorTransform.TransformPosition(LocalBounds.GetCenter()));
+				const double Radius = LocalBounds.GetExtent().Size() * ActorTransform.GetMaximumAxisScale();
+				AddExtent(LocalSpaceCenter.X, FMath::Abs(LocalSpaceCenter.Y) + Radius * HorizontalSecant, FMath::Abs(LocalSpaceCenter.Z) + Radius * VerticalSecant);
+			}
+			else
+			{
+				/** Fitting all corners of the oriented bounds box fits their convex hull. */
+				const FTransform& ActorTransform = BWActor.Target->GetActorTransform();
+				for (int32 Corner = 0; Corner < 8; ++Corner)
+				{
+					const FVector LocalCorner = FVector(
+						(Corner & 1) ? LocalBounds.Max.X : LocalBounds.Min.X,
+						(Corner & 2) ? LocalBounds.Max.Y : LocalBounds.Min.Y,
+						(Corner & 4) ? LocalBounds.Max.Z : LocalBounds.Min.Z);
+					const FVector LocalSpaceCorner = Frame.ToLocal(ActorTransform.TransformPosition(LocalCorner));
+					AddExtent(LocalSpaceCorner.X, FMath::Abs(LocalSpaceCorner.Y), FMath::Abs(LocalSpaceCorner.Z));
+				}
+			}
 		}
 	}
-	
+
+	return MaxExtentRatio;
+}
+
+float UResolveGroupActorExtension::GetDeltaFOV(double MaxExtentRatio, float DeltaTime)
+{
+	/** Required FOV, a minimum value of DefaultFOV. Atan is monotonic, so it is only evaluated for the largest ratio. */
+	float RequiredFOV = FMath::Max(FOVRange.X, 2.0f * FMath::RadiansToDegrees(FMath::Atan(MaxExtentRatio)));
+
 	/** Damp FOV. */
 	double ResultDeltaFOV;
 	UECameraLibrary::DamperValue(FDampParams(), DeltaTime, RequiredFOV - GetCameraComponent()->FieldOfView, FOVDampTime, ResultDeltaFOV);
@@ -105,27 +170,20 @@ float UResolveGroupActorExtension::GetFOVForZoomOnly(TArray<FBoundingWrappedActo
 	return ResultDeltaFOV;
 }
 
-float UResolveGroupActorExtension::GetDistanceForDistanceOnly(TArray<FBoundingWrappedActor> TargetActors, float DeltaTime, const float& FOV)
+float UResolveGroupActorExtension::GetDeltaDistance(TArrayView<const double> Depths, TArrayView<const double> Extents, float FOV, float DeltaTime)
 {
-	/** Required distance. */
-	float RequiredDistance = 114514.0f;
-	for (FBoundingWrappedActor& BWActor : TargetActors)
+	/** Required distance. If no target constrains it, camera moves forward as far as DistanceRange allows. */
+	double RequiredDistance = 114514.0;
+
+	/** Branch-free min reduction over contiguous arrays, which compilers vectorize. */
+	const double InvTanHalfFOV = 1.0 / FMath::Tan(FMath::DegreesToRadians(FOV * 0.5));
+	const double* DepthData = Depths.GetData();
+	const double* ExtentData = Extents.GetData();
+	for (int32 Index = 0; Index < Depths.Num(); ++Index)
 	{
-		FVector LocalSpacePosition = UECameraLibrary::GetLocalSpacePosition(GetOwningActor(), BWActor.Target->GetActorLocation());
-		if (LocalSpacePosition.X > 0 && !BWActor.bExcludeBoundingBox)
-		{
-			float RightBound = (LocalSpacePosition.Y + BWActor.Width) * (1 - Tolerance);
-			float LeftBound = (LocalSpacePosition.Y - BWActor.Width) * (1 - Tolerance);
-			float TopBound = (LocalSpacePosition.Z + BWActor.Height) * (1 - Tolerance);
-			float BottomBound = (LocalSpacePosition.Z - BWActor.Height) * (1 - Tolerance);
-			
-			float TanHalfFov = UKismetMathLibrary::DegTan(FOV / 2);
-			if (RightBound > 0) RequiredDistance = FMath::Min(RequiredDistance, LocalSpacePosition.X - RightBound / TanHalfFov);
-			if (LeftBound < 0) RequiredDistance = FMath::Min(RequiredDistance, LocalSpacePosition.X + LeftBound / TanHalfFov);
-			if (TopBound > 0) RequiredDistance = FMath::Min(RequiredDistance, LocalSpacePosition.X - TopBound / TanHalfFov * GetCameraComponent()->AspectRatio);
-			if (BottomBound < 0) RequiredDistance = FMath::Min(RequiredDistance, LocalSpacePosition.X + BottomBound / TanHalfFov * GetCameraComponent()->AspectRatio);
-		}
+		RequiredDistance = FMath::Min(RequiredDistance, DepthData[Index] - ExtentData[Index] * InvTanHalfFOV);
 	}
+
 	/** Damp distance. */
 	double ResultDeltaDistance;
 	UECameraLibrary::DamperValue(FDampParams(), DeltaTime, RequiredDistance, DistanceDampTime, ResultDeltaDistance);
@@ -134,4 +192,4 @@ float UResolveGroupActorExtension::GetDistanceForDistanceOnly(TArray<FBoundingWr
 	if (ResultDeltaDistance + AdjustedDistance < DistanceRange.X) ResultDeltaDistance = DistanceRange.X - AdjustedDistance;
 	AdjustedDistance += ResultDeltaDistance;
 	return ResultDeltaDistance;
-}
\ No newline at end of file
+}
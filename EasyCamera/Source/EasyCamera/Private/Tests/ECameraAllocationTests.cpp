@@ -0,0 +1,127 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#include "Core/ECameraBase.h"
+#include "Core/ECameraSettingsComponent.h"
+#include "Components/SimpleFollow.h"
+#include "Components/TargetingAim.h"
+#include "GameFramework/DefaultPawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UnrealType.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ECameraAllocationTests
+{
+	/** Forwards to the wrapped allocator, counting allocations made by game thread while enabled. */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		FMalloc* Inner = nullptr;
+		std::atomic<bool> bCounting = false;
+		std::atomic<int32> NumAllocations = 0;
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("ECameraCountingMalloc"); }
+
+	private:
+		void CountAllocation()
+		{
+			if (bCounting && IsInGameThread()) ++NumAllocations;
+		}
+	};
+
+	/** Set an instanced component property of the settings component, which is otherwise only set from the editor. */
+	void SetInstancedComponent(UECameraSettingsComponent* Settings, FName PropertyName, UObject* Component)
+	{
+		FObjectProperty* Property = FindFProperty<FObjectProperty>(UECameraSettingsComponent::StaticClass(), PropertyName);
+		check(Property != nullptr);
+		Property->SetObjectPropertyValue_InContainer(Settings, Component);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECameraSteadyStateAllocationTest, "EasyCamera.Pipeline.SteadyStateAllocations",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FECameraSteadyStateAllocationTest::RunTest(const FString& Parameters)
+{
+	using namespace ECameraAllocationTests;
+
+	if (!TestNotNull(TEXT("Engine"), GEngine)) return false;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	APlayerController* PlayerController = World->SpawnActor<APlayerController>();
+	ADefaultPawn* Target = World->SpawnActor<ADefaultPawn>(FVector::ZeroVector, FRotator::ZeroRotator);
+	AECameraBase* Camera = World->SpawnActor<AECameraBase>(FVector(-500, 0, 200), FRotator::ZeroRotator);
+	UECameraSettingsComponent* Settings = Camera->GetSettingsComponent();
+
+	/** A follow and an aim component reading target kinematics, damping and using the cached camera frame. */
+	SetInstancedComponent(Settings, TEXT("FollowComponent"), NewObject<USimpleFollow>(Settings));
+	SetInstancedComponent(Settings, TEXT("AimComponent"), NewObject<UTargetingAim>(Settings));
+	Settings->InitializeECameraComponents();
+	Settings->SetFollowTarget(Target);
+	Settings->SetAimTarget(Target);
+
+	Camera->bPreserveState = false;
+	PlayerController->SetViewTarget(Camera);
+	TestTrue(TEXT("Camera is active"), Settings->IsActive());
+
+	/** Install the counting allocator. It is never freed, since other threads may still be inside it after it is uninstalled. */
+	static FCountingMalloc CountingMalloc;
+	CountingMalloc.Inner = GMalloc;
+	GMalloc = &CountingMalloc;
+
+	/** Each tick is a new frame with the target moving, so per-frame caches are rebuilt as in game. Only the camera tick itself is counted. */
+	const float DeltaTime = 1.0f / 60.0f;
+	auto TickCamera = [&](int32 Frame, bool bCount)
+	{
+		++GFrameCounter;
+		Target->SetActorLocationAndRotation(FVector(Frame * 10.0, FMath::Sin(Frame * 0.1) * 100.0, 0), FRotator(0, Frame * 2.0, 0));
+		CountingMalloc.bCounting = bCount;
+		Settings->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+		CountingMalloc.bCounting = false;
+	};
+
+	/** Warm up, so that memory stack chunks and reusable member arrays reach their steady state capacity. */
+	constexpr int32 NumWarmUpFrames = 16;
+	constexpr int32 NumMeasuredFrames = 64;
+	for (int32 Frame = 0; Frame < NumWarmUpFrames; ++Frame) TickCamera(Frame, false);
+
+	CountingMalloc.NumAllocations = 0;
+	for (int32 Frame = NumWarmUpFrames; Frame < NumWarmUpFrames + NumMeasuredFrames; ++Frame) TickCamera(Frame, true);
+
+	GMalloc = CountingMalloc.Inner;
+
+	TestEqual(TEXT("Heap allocations in steady state camera ticks"), CountingMalloc.NumAllocations.load(), 0);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif
@@ -0,0 +1,122 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#include "Utils/ECameraLibrary.h"
+#include "Utils/ECameraTypes.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ECameraLibraryTests
+{
+	/** Score candidates one by one, as aim assist did before candidates were scored in blocks. */
+	int32 FindClosestCandidateSequential(const FECameraFrame& Frame, const TArray<FVector>& Positions, double MaxDistance, float& OutScreenDistance)
+	{
+		int32 BestIndex = INDEX_NONE;
+		OutScreenDistance = MAX_flt;
+		for (int32 Index = 0; Index < Positions.Num(); ++Index)
+		{
+			const FVector LocalPosition = Frame.ToLocal(Positions[Index]);
+			if (LocalPosition.X <= 0 || LocalPosition.X > MaxDistance) continue;
+
+			const float Distance = FMath::Sqrt(LocalPosition.Y * LocalPosition.Y + LocalPosition.Z * LocalPosition.Z);
+			if (Distance < OutScreenDistance)
+			{
+				OutScreenDistance = Distance;
+				BestIndex = Index;
+			}
+		}
+		return BestIndex;
+	}
+
+	/** Run both implementations on the same candidates and report any difference. */
+	bool CompareWithSequential(FAutomationTestBase& Test, const FString& What, const FECameraFrame& Frame, const TArray<FVector>& Positions, double MaxDistance)
+	{
+		TArray<double> PositionsX, PositionsY, PositionsZ;
+		for (const FVector& Position : Positions)
+		{
+			PositionsX.Add(Position.X);
+			PositionsY.Add(Position.Y);
+			PositionsZ.Add(Position.Z);
+		}
+
+		float ScreenDistance = 0.0f;
+		float ExpectedScreenDistance = 0.0f;
+		const int32 Index = UECameraLibrary::FindClosestAimAssistCandidate(Frame, PositionsX, PositionsY, PositionsZ, MaxDistance, ScreenDistance);
+		const int32 ExpectedIndex = FindClosestCandidateSequential(Frame, Positions, MaxDistance, ExpectedScreenDistance);
+
+		bool bPassed = Test.TestEqual(*(What + TEXT(": index")), Index, ExpectedIndex);
+		if (ExpectedIndex != INDEX_NONE)
+		{
+			bPassed &= Test.TestEqual(*(What + TEXT(": screen distance")), ScreenDistance, ExpectedScreenDistance, 0.0f);
+		}
+		return bPassed;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECameraAimAssistCandidateTest, "EasyCamera.Library.FindClosestAimAssistCandidate",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FECameraAimAssistCandidateTest::RunTest(const FString& Parameters)
+{
+	using namespace ECameraLibraryTests;
+
+	const FECameraFrame IdentityFrame;
+	const double MaxDistance = 1000.0;
+
+	/** Equal distances to the view axis resolve to the lowest index, also when the tied candidates fall into different lanes or the remainder. */
+	{
+		const TArray<FVector> Positions =
+		{
+			FVector(500, 40, 0), FVector(500, 0, 30), FVector(500, 20, 0), FVector(500, 0, 30),
+			FVector(500, -30, 0), FVector(500, 0, -20), FVector(500, 20, 0)
+		};
+		CompareWithSequential(*this, TEXT("Ties"), IdentityFrame, Positions, MaxDistance);
+
+		float ScreenDistance = 0.0f;
+		const TArray<double> X = { 500, 500, 500, 500, 500 }, Y = { 10, -10, 0, 0, 10 }, Z = { 0, 0, 10, -10, 0 };
+		TestEqual(TEXT("Ties: lowest index"), UECameraLibrary::FindClosestAimAssistCandidate(IdentityFrame, X, Y, Z, MaxDistance, ScreenDistance), 0);
+	}
+
+	/** Candidates exactly at MaxDistance pass, candidates beyond it do not. */
+	{
+		const TArray<FVector> Positions = { FVector(MaxDistance + 0.001, 0, 0), FVector(MaxDistance, 5, 0), FVector(MaxDistance + 1, 1, 0) };
+		CompareWithSequential(*this, TEXT("MaxDistance boundary"), IdentityFrame, Positions, MaxDistance);
+
+		float ScreenDistance = 0.0f;
+		const TArray<double> X = { MaxDistance + 0.001, MaxDistance }, Y = { 0, 5 }, Z = { 0, 0 };
+		TestEqual(TEXT("MaxDistance boundary: inclusive"), UECameraLibrary::FindClosestAimAssistCandidate(IdentityFrame, X, Y, Z, MaxDistance, ScreenDistance), 1);
+	}
+
+	/** Candidates behind or level with camera are ignored, even if they lie on the view axis. */
+	{
+		const TArray<FVector> Positions = { FVector(-100, 0, 0), FVector(0, 0, 0), FVector(0, 1, 0), FVector(-1, 0, 0), FVector(300, 50, 0) };
+		CompareWithSequential(*this, TEXT("Behind camera"), IdentityFrame, Positions, MaxDistance);
+
+		float ScreenDistance = 0.0f;
+		const TArray<double> X = { -100, 0, -1 }, Y = { 0, 0, 0 }, Z = { 0, 0, 0 };
+		TestEqual(TEXT("Behind camera: none"), UECameraLibrary::FindClosestAimAssistCandidate(IdentityFrame, X, Y, Z, MaxDistance, ScreenDistance), (int32)INDEX_NONE);
+	}
+
+	/** Random candidates around a rotated camera, for counts that leave every possible remainder after whole blocks. */
+	FRandomStream Random(20230);
+	for (int32 Round = 0; Round < 8; ++Round)
+	{
+		const FECameraFrame Frame(Random.GetUnitVector() * 200.0, FRotator(Random.FRandRange(-80, 80), Random.FRandRange(-180, 180), 0).Quaternion());
+		for (int32 NumCandidates = 0; NumCandidates <= 13; ++NumCandidates)
+		{
+			TArray<FVector> Positions;
+			for (int32 Index = 0; Index < NumCandidates; ++Index)
+			{
+				/** Quantized positions make exact ties likely. */
+				const FVector Local = FVector(FMath::RoundToDouble(Random.FRandRange(-200, 1200) / 50.0) * 50.0, FMath::RoundToDouble(Random.FRandRange(-3, 3)) * 10.0, FMath::RoundToDouble(Random.FRandRange(-3, 3)) * 10.0);
+				Positions.Add(Frame.ToWorld(Local));
+			}
+			CompareWithSequential(*this, FString::Printf(TEXT("Random round %d, %d candidates"), Round, NumCandidates), Frame, Positions, MaxDistance);
+		}
+	}
+
+	return true;
+}
+
+#endif
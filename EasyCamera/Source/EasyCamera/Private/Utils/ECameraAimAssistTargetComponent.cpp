@@ -0,0 +1,52 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#include "Utils/ECameraAimAssistTargetComponent.h"
+#include "Core/ECameraAimAssistSubsystem.h"
+#include "Engine/World.h"
+
+UECameraAimAssistTargetComponent::UECameraAimAssistTargetComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	Offset = FVector(0, 0, 0);
+}
+
+void UECameraAimAssistTargetComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	UWorld* World = GetWorld();
+	if (World != nullptr && World->IsGameWorld())
+	{
+		if (UECameraAimAssistSubsystem* AimAssistSubsystem = World->GetSubsystem<UECameraAimAssistSubsystem>())
+		{
+			AimAssistSubsystem->RegisterTarget(this, GetOwner(), Offset);
+		}
+	}
+}
+
+void UECameraAimAssistTargetComponent::OnUnregister()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UECameraAimAssistSubsystem* AimAssistSubsystem = World->GetSubsystem<UECameraAimAssistSubsystem>())
+		{
+			AimAssistSubsystem->UnregisterTarget(this);
+		}
+	}
+
+	Super::OnUnregister();
+}
+
+void UECameraAimAssistTargetComponent::SetOffset(const FVector& InOffset)
+{
+	Offset = InOffset;
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UECameraAimAssistSubsystem* AimAssistSubsystem = World->GetSubsystem<UECameraAimAssistSubsystem>())
+		{
+			AimAssistSubsystem->SetTargetOffset(this, Offset);
+		}
+	}
+}
@@ -16,7 +16,13 @@ AECameraGroupActor::AECameraGroupActor()
 
 void AECameraGroupActor::Tick(float DeltaTime)
 {
-	SetActorLocation(CameraGroupActorComponent->GetGroupActorLocation());
-	SetActorRotation(CameraGroupActorComponent->GetGroupActorRotation());
+	/** Nothing to do if no active camera follows or aims at this group. Tick is enabled again once a camera consumes it. */
+	if (!CameraGroupActorComponent->IsConsumed())
+	{
+		SetActorTickEnabled(false);
+		return;
+	}
+
+	CameraGroupActorComponent->UpdateOwnerTransform();
 }
 
@@ -13,6 +13,260 @@ UECameraGroupActorComponent::UECameraGroupActorComponent()
 	SpecifiedLocation = FVector(0, 0, 0);
 	GroupRotationMethod = EGroupRotationMethod::Specified;
 	SpecifiedRotation = FRotator::ZeroRotator;
+	MoveThreshold = 0.1f;
+	bAlwaysUpdate = true;
+
+	NumLiveMembers = 0;
+	bAnyNonZeroWeight = false;
+	WeightSum = 0.0;
+	PositionSum = FVector::ZeroVector;
+	WeightedPositionSum = FVector::ZeroVector;
+	DistanceWeightSum = 0.0;
+	DistancePositionSum = FVector::ZeroVector;
+	WeightedDistanceWeightSum = 0.0;
+	WeightedDistancePositionSum = FVector::ZeroVector;
+	ClosestIndex = INDEX_NONE;
+	FarestIndex = INDEX_NONE;
+	RefreshedAnchorLocation = FVector::ZeroVector;
+	bRefineAverageRotation = false;
+	RotationSum = FVector4(0, 0, 0, 0);
+	WeightedRotationSum = FVector4(0, 0, 0, 0);
+	bRotationsSampled = false;
+	bRotationsRequested = false;
+	bMomentsAccumulated = false;
+	FMemory::Memzero(RotationMoments);
+	FMemory::Memzero(WeightedRotationMoments);
+	AppliedLocation = FVector::ZeroVector;
+	AppliedRotation = FRotator::ZeroRotator;
+	RefreshedFrame = 0;
+	LastConsumedFrame = 0;
+}
+
+void UECameraGroupActorComponent::MarkConsumed()
+{
+	const bool bWasConsumed = IsConsumed();
+	LastConsumedFrame = GFrameCounter;
+
+	/** Owner stops ticking while idle, so bring it up to date right away instead of lagging one frame behind. */
+	if (!bWasConsumed)
+	{
+		if (AActor* Owner = GetOwner()) Owner->SetActorTickEnabled(true);
+		UpdateOwnerTransform();
+	}
+}
+
+bool UECameraGroupActorComponent::IsConsumed() const
+{
+	return bAlwaysUpdate || LastConsumedFrame + 1 >= GFrameCounter;
+}
+
+bool UECameraGroupActorComponent::RefreshMembers()
+{
+	RefreshedFrame = GFrameCounter;
+
+	const int32 NumMembers = TargetActors.Num();
+	bool bChanged = false;
+	if (MemberActors.Num() != NumMembers)
+	{
+		/** Drop bounds of members in truncated slots. Null keys never match a live target, so every live member is sampled afresh below. */
+		for (int32 Index = NumMembers; Index < MemberActors.Num(); ++Index) MemberLocalBounds.Remove(MemberActors[Index]);
+		MemberActors.SetNum(NumMembers);
+		MemberWeights.SetNumZeroed(NumMembers);
+		MemberPositions.SetNumZeroed(NumMembers);
+		MemberRotations.SetNumZeroed(NumMembers);
+		bChanged = true;
+	}
+
+	const double ThresholdSquared = FMath::Square(MoveThreshold);
+	const FVector AnchoredLocation = AnchorLocationActor ? AnchorLocationActor->GetActorLocation() : AnchorLocation;
+	if (FVector::DistSquared(AnchoredLocation, RefreshedAnchorLocation) > ThresholdSquared)
+	{
+		RefreshedAnchorLocation = AnchoredLocation;
+		bChanged = true;
+	}
+
+	/** Rotations are only sampled and accumulated if a rotation method needs them, or GetAverageRotation has been called directly. */
+	const bool bSampleRotations = GroupRotationMethod != EGroupRotationMethod::Specified || bRotationsRequested;
+	const bool bAccumulateMoments = bSampleRotations && bRefineAverageRotation;
+	if (bSampleRotations != bRotationsSampled || bAccumulateMoments != bMomentsAccumulated) bChanged = true;
+	bRotationsSampled = bSampleRotations;
+	bMomentsAccumulated = bAccumulateMoments;
+
+	/** Sample members, only keeping positions and rotations that changed beyond the threshold. */
+	for (int32 Index = 0; Index < NumMembers; ++Index)
+	{
+		const AActor* Target = TargetActors[Index].Target;
+		const float Weight = TargetActors[Index].Weight;
+
+		/** Compared by key, so a destroyed member whose address is reused by a new actor is still detected as a swap. */
+		const TObjectKey<AActor> TargetKey(Target);
+		if (TargetKey != MemberActors[Index] || Weight != MemberWeights[Index])
+		{
+			if (TargetKey != MemberActors[Index]) MemberLocalBounds.Remove(MemberActors[Index]);
+			MemberActors[Index] = TargetKey;
+			MemberWeights[Index] = Weight;
+			if (Target != nullptr)
+			{
+				MemberPositions[Index] = Target->GetActorLocation();
+				MemberRotations[Index] = Target->GetActorQuat();
+			}
+			bChanged = true;
+		}
+		else if (Target != nullptr)
+		{
+			const FVector Position = Target->GetActorLocation();
+			if (FVector::DistSquared(Position, MemberPositions[Index]) > ThresholdSquared)
+			{
+				MemberPositions[Index] = Position;
+				bChanged = true;
+			}
+			if (bSampleRotations)
+			{
+				const FQuat Rotation = Target->GetActorQuat();
+				if (!Rotation.Equals(MemberRotations[Index]))
+				{
+					MemberRotations[Index] = Rotation;
+					bChanged = true;
+				}
+			}
+		}
+	}
+
+	/** Aggregates only depend on sampled member data and the anchor, so they stay valid until any of them changes. */
+	if (!bChanged) return false;
+
+	NumLiveMembers = 0;
+	bAnyNonZeroWeight = false;
+	WeightSum = 0.0;
+	PositionSum = FVector::ZeroVector;
+	WeightedPositionSum = FVector::ZeroVector;
+	DistanceWeightSum = 0.0;
+	DistancePositionSum = FVector::ZeroVector;
+	WeightedDistanceWeightSum = 0.0;
+	WeightedDistancePositionSum = FVector::ZeroVector;
+	ClosestIndex = INDEX_NONE;
+	FarestIndex = INDEX_NONE;
+	double ClosestDistanceSquared = 0.0;
+	double FarestDistanceSquared = 0.0;
+
+	RotationSum = FVector4(0, 0, 0, 0);
+	WeightedRotationSum = FVector4(0, 0, 0, 0);
+	if (bAccumulateMoments)
+	{
+		FMemory::Memzero(RotationMoments);
+		FMemory::Memzero(WeightedRotationMoments);
+	}
+	FQuat ReferenceRotation = FQuat::Identity;
+	bool bHasReferenceRotation = false;
+
+	for (int32 Index = 0; Index < NumMembers; ++Index)
+	{
+		if (TargetActors[Index].Target == nullptr) continue;
+		const float Weight = MemberWeights[Index];
+
+		/** Accumulate aggregates of every location method, so that switching methods needs no extra pass. */
+		const FVector& Position = MemberPositions[Index];
+		++NumLiveMembers;
+		bAnyNonZeroWeight |= Weight != 0.0f;
+		WeightSum += Weight;
+		PositionSum += Position;
+		WeightedPositionSum += Position * Weight;
+
+		/** Larger the distance is, smaller the weight is. Normalizing weights by their sum cancels out, so it is skipped. */
+		const double DistanceSquared = FVector::DistSquared(RefreshedAnchorLocation, Position);
+		const double InverseDistance = 100.0 / FMath::Max(DistanceSquared, UE_SMALL_NUMBER);
+		DistanceWeightSum += InverseDistance;
+		DistancePositionSum += Position * InverseDistance;
+		WeightedDistanceWeightSum += InverseDistance * Weight;
+		WeightedDistancePositionSum += Position * (InverseDistance * Weight);
+
+		if (ClosestIndex == INDEX_NONE || DistanceSquared < ClosestDistanceSquared)
+		{
+			ClosestIndex = Index;
+			ClosestDistanceSquared = DistanceSquared;
+		}
+		if (FarestIndex == INDEX_NONE || DistanceSquared > FarestDistanceSquared)
+		{
+			FarestIndex = Index;
+			FarestDistanceSquared = DistanceSquared;
+		}
+
+		if (!bSampleRotations) continue;
+
+		/** q and -q are the same rotation, so flip each quaternion into the hemisphere of the first one before summing. */
+		const FQuat& Rotation = MemberRotations[Index];
+		if (!bHasReferenceRotation)
+		{
+			ReferenceRotation = Rotation;
+			bHasReferenceRotation = true;
+		}
+		const double Sign = (Rotation | ReferenceRotation) < 0.0 ? -1.0 : 1.0;
+		const FVector4 Aligned = FVector4(Rotation.X * Sign, Rotation.Y * Sign, Rotation.Z * Sign, Rotation.W * Sign);
+		RotationSum += Aligned;
+		WeightedRotationSum += Aligned * Weight;
+
+		if (bAccumulateMoments)
+		{
+			const double Q[4] = { Rotation.X, Rotation.Y, Rotation.Z, Rotation.W };
+			int32 Moment = 0;
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Column = Row; Column < 4; ++Column, ++Moment)
+				{
+					const double Product = Q[Row] * Q[Column];
+					RotationMoments[Moment] += Product;
+					WeightedRotationMoments[Moment] += Product * Weight;
+				}
+			}
+		}
+	}
+
+	return bChanged;
+}
+
+const FBox& UECameraGroupActorComponent::GetMemberLocalBounds(const AActor* Target)
+{
+	/** Local space bounds stay valid while the member moves and rotates. Components added, removed or resized are detected by a cheap signature. */
+	const USceneComponent* RootComponent = Target->GetRootComponent();
+	const int32 NumComponents = Target->GetComponents().Num();
+	const float RootRadius = RootComponent != nullptr ? RootComponent->Bounds.SphereRadius : 0.0f;
+
+	FECameraGroupMemberBounds& Bounds = MemberLocalBounds.FindOrAdd(TObjectKey<AActor>(Target), FECameraGroupMemberBounds{ FBox(ForceInit), INDEX_NONE, 0.0f });
+	if (Bounds.NumComponents != NumComponents || FMath::Abs(RootRadius - Bounds.RootRadius) > BoundsRadiusTolerance * FMath::Max(Bounds.RootRadius, UE_KINDA_SMALL_NUMBER))
+	{
+		Bounds.LocalBounds = Target->CalculateComponentsBoundingBoxInLocalSpace(true);
+		Bounds.NumComponents = NumComponents;
+		Bounds.RootRadius = RootRadius;
+	}
+	return Bounds.LocalBounds;
+}
+
+void UECameraGroupActorComponent::RefreshMemberBounds()
+{
+	MemberLocalBounds.Reset();
+}
+
+void UECameraGroupActorComponent::EnsureRefreshed()
+{
+	if (RefreshedFrame != GFrameCounter) RefreshMembers();
+}
+
+void UECameraGroupActorComponent::UpdateOwnerTransform()
+{
+	AActor* Owner = GetOwner();
+	if (Owner == nullptr) return;
+
+	EnsureRefreshed();
+
+	/** Location and rotation are finalized from aggregates in constant time. */
+	const FVector Location = GetGroupActorLocation();
+	const FRotator Rotation = GetGroupActorRotation();
+	if (!Location.Equals(AppliedLocation, 0.0) || !Rotation.Equals(AppliedRotation, 0.0) || !Owner->GetActorLocation().Equals(AppliedLocation, 0.0))
+	{
+		Owner->SetActorLocationAndRotation(Location, Rotation);
+		AppliedLocation = Owner->GetActorLocation();
+		AppliedRotation = Rotation;
+	}
 }
 
 FVector UECameraGroupActorComponent::GetGroupActorLocation_Implementation()
@@ -84,49 +338,56 @@ FRotator UECameraGroupActorComponent::GetGroupActorRotation_Implementation()
 
 FVector UECameraGroupActorComponent::GetAverageLocation(bool bIsArithemetic)
 {	
-	/** Get normalizer. */
-	float Normalizer = 1.0f;
-	if (!bIsArithemetic) Normalizer = GetNormalizer();
+	EnsureRefreshed();
+	if (NumLiveMembers == 0) return FVector();
 
-	/** Number of alive actors. */
-	int NumberOfLiveActors = 0;
-	for (int index = 0; index < TargetActors.Num(); ++index)
-		if (TargetActors[index].Target)
-			++NumberOfLiveActors;
-	if (NumberOfLiveActors == 0) return FVector();
-
-	/** Get average location. */
-	FVector ResultLocation = FVector();
-	for (int index = 0; index < TargetActors.Num(); ++index)
-	{
-		if (bIsArithemetic && TargetActors[index].Target) 
-			ResultLocation += TargetActors[index].Target->GetActorLocation() / NumberOfLiveActors;
-		else if (TargetActors[index].Target)
-			ResultLocation += TargetActors[index].Target->GetActorLocation() * TargetActors[index].Weight / Normalizer;
-	}
-
-	return ResultLocation;
+	if (bIsArithemetic || WeightSum == 0.0) return PositionSum / NumLiveMembers;
+	else return WeightedPositionSum / WeightSum;
 }
 
 FRotator UECameraGroupActorComponent::GetAverageRotation(bool bIsArithemetic)
 {
-	/** Get normalizer. */
-	float Normalizer = 1.0f;
-	if (!bIsArithemetic) Normalizer = GetNormalizer();
+	EnsureRefreshed();
+
+	/** Called directly while GroupRotationMethod does not need rotations, so start sampling them from now on. */
+	if (!bRotationsSampled)
+	{
+		bRotationsRequested = true;
+		RefreshMembers();
+	}
+	if (NumLiveMembers == 0) return FRotator();
 
-	/** Number of alive actors. */
-	int NumberOfLiveActors = 0;
-	for (int index = 0; index < TargetActors.Num(); ++index)
-		if (TargetActors[index].Target)
-			++NumberOfLiveActors;
-	if (NumberOfLiveActors == 0) return FRotator();
+	const bool bUseWeights = !bIsArithemetic && bAnyNonZeroWeight;
+	const FVector4& Sum = bUseWeights ? WeightedRotationSum : RotationSum;
+	FQuat ResultQuat = FQuat(Sum.X, Sum.Y, Sum.Z, Sum.W);
+	if (ResultQuat.SizeSquared() < UE_SMALL_NUMBER) return FRotator();
+	ResultQuat.Normalize();
 
-	/** Get average rotation. */
-	FQuat ResultQuat = FQuat::Identity;
-	for (int index = 0; index < TargetActors.Num(); ++index)
+	/** The normalized sum is a close initial guess of the principal eigenvector, so power iteration converges in a few steps. */
+	if (bRefineAverageRotation)
 	{
-		if (TargetActors[index].Target)
-			ResultQuat *= FQuat::Slerp(FQuat::Identity, TargetActors[index].Target->GetActorQuat(), bIsArithemetic ? 1.0f / NumberOfLiveActors : FMath::Square(TargetActors[index].Weight) / Normalizer);
+		const double* Moments = bUseWeights ? WeightedRotationMoments : RotationMoments;
+		const double M[4][4] =
+		{
+			{ Moments[0], Moments[1], Moments[2], Moments[3] },
+			{ Moments[1], Moments[4], Moments[5], Moments[6] },
+			{ Moments[2], Moments[5], Moments[7], Moments[8] },
+			{ Moments[3], Moments[6], Moments[8], Moments[9] }
+		};
+
+		double V[4] = { ResultQuat.X, ResultQuat.Y, ResultQuat.Z, ResultQuat.W };
+		for (int32 Iteration = 0; Iteration < 8; ++Iteration)
+		{
+			double Next[4];
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				Next[Row] = M[Row][0] * V[0] + M[Row][1] * V[1] + M[Row][2] * V[2] + M[Row][3] * V[3];
+			}
+			const double Length = FMath::Sqrt(Next[0] * Next[0] + Next[1] * Next[1] + Next[2] * Next[2] + Next[3] * Next[3]);
+			if (Length < UE_SMALL_NUMBER) break;
+			for (int32 Row = 0; Row < 4; ++Row) V[Row] = Next[Row] / Length;
+		}
+		ResultQuat = FQuat(V[0], V[1], V[2], V[3]);
 	}
 
 	return ResultQuat.Rotator();
@@ -134,83 +395,33 @@ FRotator UECameraGroupActorComponent::GetAverageRotation(bool bIsArithemetic)
 
 bool UECameraGroupActorComponent::CheckWeightAllZero()
 {
-	for (int index = 0; index < TargetActors.Num(); ++index)
-		if (TargetActors[index].Target && TargetActors[index].Weight != 0)
-			return false;
-	return true;
+	EnsureRefreshed();
+	return !bAnyNonZeroWeight;
 }
 
 float UECameraGroupActorComponent::GetNormalizer()
 {
-	float Normalizer = 0.0f;
-	for (int index = 0; index < TargetActors.Num(); ++index)
-		if (TargetActors[index].Target)
-			Normalizer += TargetActors[index].Weight;
-	return Normalizer;
+	EnsureRefreshed();
+	return WeightSum;
 }
 
 FVector UECameraGroupActorComponent::GetFarestOrClosestLocation(bool bIsFarest)
 {
-	/** First find first alive actor and use its location. */
-	int ResultIndex = -1;
-	float ResultDistance = 0.0f;
-	for (int index = 0; index < TargetActors.Num(); ++index)
-		if (TargetActors[index].Target)
-		{
-			ResultIndex = index;
-			ResultDistance = AnchorLocationActor ? FVector::DistSquared(AnchorLocationActor->GetActorLocation(), TargetActors[index].Target->GetActorLocation()) : FVector::DistSquared(AnchorLocation, TargetActors[index].Target->GetActorLocation());
-			break;
-		}
+	EnsureRefreshed();
 
 	/** All target actors are not alive. */
-	if (ResultIndex == -1) return FVector();
-
-	/** Else, find the closest or farest location. */
-	for (int index = ResultIndex + 1; index < TargetActors.Num(); ++index)
-	{
-		float Distance = AnchorLocationActor ? FVector::DistSquared(AnchorLocationActor->GetActorLocation(), TargetActors[index].Target->GetActorLocation()) : FVector::DistSquared(AnchorLocation, TargetActors[index].Target->GetActorLocation());
-		if (!bIsFarest && Distance < ResultDistance || bIsFarest && Distance > ResultDistance)
-		{
-			ResultDistance = Distance;
-			ResultIndex = index;
-		}
-	}
+	const int32 ResultIndex = bIsFarest ? FarestIndex : ClosestIndex;
+	if (ResultIndex == INDEX_NONE) return FVector();
 
-	return TargetActors[ResultIndex].Target->GetActorLocation();
+	return MemberPositions[ResultIndex];
 }
 
 FVector UECameraGroupActorComponent::GetLocationBasedOnDistance(bool bIsWeighted)
 {
-	/** AnchoredLocation is used for calculating distance. */
-	FVector AnchoredLocation = AnchorLocationActor ? AnchorLocationActor->GetActorLocation() : AnchorLocation;
-	FVector ResultLocation = FVector();
-	float Normalizer = 0.0f;
-	float WeightNormalizer = GetNormalizer();
-	TArray<float> TempWeights;
+	EnsureRefreshed();
 
-	for (int index = 0; index < TargetActors.Num(); ++index)
-	{
-		if (TargetActors[index].Target)
-		{
-			/** Larger the distance is, smaller the weight is. */
-			float InverseDistance = 100.0f / FVector::DistSquared(AnchoredLocation, TargetActors[index].Target->GetActorLocation());
-			if (!bIsWeighted)
-			{
-				TempWeights.Add(InverseDistance);
-				Normalizer += InverseDistance;
-			}
-			else
-			{
-				TempWeights.Add(InverseDistance * TargetActors[index].Weight / WeightNormalizer);
-				Normalizer += InverseDistance * TargetActors[index].Weight / WeightNormalizer;
-			}
-		}
-		else TempWeights.Add(-1.0f);
-	}
+	const double Normalizer = bIsWeighted ? WeightedDistanceWeightSum : DistanceWeightSum;
+	if (Normalizer == 0.0) return FVector();
 
-	for (int index = 0; index < TargetActors.Num(); ++index)
-		if (TargetActors[index].Target)
-			ResultLocation += TargetActors[index].Target->GetActorLocation() * TempWeights[index] / Normalizer;
-	
-	return ResultLocation;
-}
\ No newline at end of file
+	return (bIsWeighted ? WeightedDistancePositionSum : DistancePositionSum) / Normalizer;
+}
@@ -12,6 +12,7 @@
 #include "Core/ECameraSettingsComponent.h"
 #include "Core/ECameraBase.h"
 #include "Core/ECameraManager.h"
+#include "Core/ECameraAimAssistSubsystem.h"
 #include "Components/ECameraComponentFollow.h"
 #include "Components/ECameraComponentAim.h"
 #include "Components/FramingFollow.h"
@@ -170,18 +171,13 @@ void AECameraHUD::DrawHUD()
 						AECameraGroupActor* FollowGroupActor = Cast<AECameraGroupActor>(GroupActorResolver->GetOwningSettingComponent()->GetFollowTarget());
 						AECameraGroupActor* AimGroupActor = Cast<AECameraGroupActor>(GroupActorResolver->GetOwningSettingComponent()->GetAimTarget());
 
-						TArray<FBoundingWrappedActor> FollowTargetActorsRef;
-						TArray<FBoundingWrappedActor> AimTargetActorsRef;
-
 						if (FollowGroupActor)
 						{
-							FollowTargetActorsRef.Append(FollowGroupActor->CameraGroupActorComponent->TargetActors);
-							DrawRectOnScreenForGroupActors(FollowPositionColor, FollowTargetActorsRef);
+							DrawRectOnScreenForGroupActors(FollowPositionColor, FollowGroupActor->CameraGroupActorComponent->TargetActors);
 						}
 						if (AimGroupActor)
 						{
-							AimTargetActorsRef.Append(AimGroupActor->CameraGroupActorComponent->TargetActors);
-							DrawRectOnScreenForGroupActors(AimPositionColor, AimTargetActorsRef);
+							DrawRectOnScreenForGroupActors(AimPositionColor, AimGroupActor->CameraGroupActorComponent->TargetActors);
 						}
 					}
 				}
@@ -211,9 +207,9 @@ void AECameraHUD::DrawRectOnScreenWithPosition(FLinearColor Color, FVector& Posi
 	DrawRect(Color, ScreenPosition.X - Radius, ScreenPosition.Y - Radius, 2 * Radius, 2 * Radius);
 }
 
-void AECameraHUD::DrawRectOnScreenForGroupActors(FLinearColor Color, TArray<FBoundingWrappedActor>& TargetActors)
+void AECameraHUD::DrawRectOnScreenForGroupActors(FLinearColor Color, const TArray<FBoundingWrappedActor>& TargetActors)
 {
-	for (FBoundingWrappedActor& BWActor : TargetActors)
+	for (const FBoundingWrappedActor& BWActor : TargetActors)
 	{
 		if (!BWActor.bExcludeBoundingBox)
 		{
@@ -228,23 +224,32 @@ void AECameraHUD::DrawRectOnScreenForGroupActors(FLinearColor Color, TArray<FBou
 
 void AECameraHUD::DrawRectOnScreenForAimAssist(FLinearColor Color, UControlAim* ControlAim, const FAimAssist& AimAssist)
 {
-	if (AimAssist.bEnableAimAssist)
+	UECameraAimAssistSubsystem* AimAssistSubsystem = GetWorld()->GetSubsystem<UECameraAimAssistSubsystem>();
+	if (AimAssist.bEnableAimAssist && AimAssistSubsystem != nullptr)
 	{
-		for (const FOffsetActorType& OffsetTargetType : AimAssist.TargetTypes)
+		const FECameraFrame Frame = UECameraLibrary::MakeCameraFrame(ControlAim->GetOwningActor());
+
+		TBitArray<> RelevantTypes;
+		AimAssistSubsystem->GetRelevantTypes(AimAssist.TargetTypes, RelevantTypes);
+
+		TArrayView<const TWeakObjectPtr<AActor>> Actors = AimAssistSubsystem->GetCandidateActors();
+		TArrayView<const FVector> Offsets = AimAssistSubsystem->GetCandidateOffsets();
+		TArrayView<const int32> Types = AimAssistSubsystem->GetCandidateTypes();
+		for (int32 Index = 0; Index < Actors.Num(); ++Index)
 		{
-			TArray<AActor*> OutActors;
-			UGameplayStatics::GetAllActorsOfClass(GetWorld(), OffsetTargetType.ActorType, OutActors);
-			for (AActor* TargetActor : OutActors)
-			{
-				FVector RealPosition = UECameraLibrary::GetPositionWithLocalOffset(TargetActor, OffsetTargetType.Offset);
-				FVector LocalSpacePosition = UECameraLibrary::GetLocalSpacePosition(ControlAim->GetOwningActor(), RealPosition);
+			if (Types[Index] != INDEX_NONE && !RelevantTypes[Types[Index]]) continue;
 
-				if (LocalSpacePosition.X > 0 && LocalSpacePosition.X <= AimAssist.MaxDistance)
-				{
-					FVector2D ScreenPosition;
-					UGameplayStatics::ProjectWorldToScreen(PlayerOwner, RealPosition, ScreenPosition);
-					DrawRect(Color, ScreenPosition.X - AimAssist.MagneticRadius, ScreenPosition.Y - AimAssist.MagneticRadius, 2 * AimAssist.MagneticRadius, 2 * AimAssist.MagneticRadius);
-				}
+			AActor* TargetActor = Actors[Index].Get();
+			if (TargetActor == nullptr) continue;
+
+			FVector RealPosition = UECameraLibrary::GetPositionWithLocalOffset(TargetActor, Offsets[Index]);
+			FVector LocalSpacePosition = Frame.ToLocal(RealPosition);
+
+			if (LocalSpacePosition.X > 0 && LocalSpacePosition.X <= AimAssist.MaxDistance)
+			{
+				FVector2D ScreenPosition;
+				UGameplayStatics::ProjectWorldToScreen(PlayerOwner, RealPosition, ScreenPosition);
+				DrawRect(Color, ScreenPosition.X - AimAssist.MagneticRadius, ScreenPosition.Y - AimAssist.MagneticRadius, 2 * AimAssist.MagneticRadius, 2 * AimAssist.MagneticRadius);
 			}
 		}
 	}
@@ -175,30 +175,112 @@ void UECameraLibrary::DamperQuaternion(const FQuat& Quat1, const FQuat& Quat2, c
 
 FVector UECameraLibrary::GetLocalSpacePosition(const AActor* Camera, const FVector& InputPosition)
 {
-	FVector Diff = InputPosition - Camera->GetActorLocation();
+	return MakeCameraFrame(Camera).ToLocal(InputPosition);
+}
 
-	FVector ForwardVector = Camera->GetActorForwardVector();
-	FVector RightVector = Camera->GetActorRightVector();
-	FVector UpVector = Camera->GetActorUpVector();
+FVector UECameraLibrary::GetLocalSpacePositionWithVectors(const FVector& PivotPosition, const FVector& ForwardVector, const FVector& RightVector, const FVector& UpVector, const FVector& InputPosition)
+{
+	FVector Diff = InputPosition - PivotPosition;
+	return FVector(Diff | ForwardVector, Diff | RightVector, Diff | UpVector);
+}
 
-	FVector LocalSpaceFollowPosition =
-		UKismetMathLibrary::MakeVector(ForwardVector.X, RightVector.X, UpVector.X) * Diff.X +
-		UKismetMathLibrary::MakeVector(ForwardVector.Y, RightVector.Y, UpVector.Y) * Diff.Y +
-		UKismetMathLibrary::MakeVector(ForwardVector.Z, RightVector.Z, UpVector.Z) * Diff.Z;
+FVector UECameraLibrary::GetPredictedOffset(const FECameraTargetKinematics& Kinematics, const FPredictionParams& PredictionParams)
+{
+	if (!PredictionParams.bEnablePrediction || PredictionParams.Horizon <= 0.0f) return FVector::ZeroVector;
+
+	const FVector& Velocity = Kinematics.Velocity;
+	FVector Offset = Velocity * PredictionParams.Horizon;
+
+	if (PredictionParams.bUseAcceleration)
+	{
+		/** If acceleration opposes velocity, only extrapolate until the target stops to avoid overshooting on direction reversal. */
+		const FVector& Acceleration = Kinematics.Acceleration;
+		const double VelocityDotAcceleration = Velocity | Acceleration;
+		double Time = PredictionParams.Horizon;
+		if (VelocityDotAcceleration < 0.0)
+		{
+			Time = FMath::Min(Time, -Velocity.SizeSquared() / VelocityDotAcceleration);
+		}
+		Offset = Velocity * Time + 0.5 * Acceleration * Time * Time;
+	}
 
-	return LocalSpaceFollowPosition;
+	if (PredictionParams.MaxDistance > 0.0f)
+	{
+		Offset = Offset.GetClampedToMaxSize(PredictionParams.MaxDistance);
+	}
+	return Offset;
 }
 
-FVector UECameraLibrary::GetLocalSpacePositionWithVectors(const FVector& PivotPosition, const FVector& ForwardVector, const FVector& RightVector, const FVector& UpVector, const FVector& InputPosition)
+FECameraFrame UECameraLibrary::MakeCameraFrame(const AActor* Camera)
 {
-	FVector Diff = InputPosition - PivotPosition;
+	if (Camera == nullptr) return FECameraFrame();
+	return FECameraFrame(Camera->GetActorLocation(), Camera->GetActorQuat());
+}
+
+FVector UECameraLibrary::GetLocalSpacePositionWithFrame(const FECameraFrame& Frame, const FVector& InputPosition)
+{
+	return Frame.ToLocal(InputPosition);
+}
+
+int32 UECameraLibrary::FindClosestAimAssistCandidate(const FECameraFrame& Frame, TArrayView<const double> PositionsX, TArrayView<const double> PositionsY, TArrayView<const double> PositionsZ, double MaxDistance, float& OutScreenDistance)
+{
+	check(PositionsX.Num() == PositionsY.Num() && PositionsX.Num() == PositionsZ.Num());
+
+	/** Each lane keeps its own best candidate, so candidates within a block are scored independently of each other, and comparisons are branchless selects.
+	 *  Expressions mirror FECameraFrame::ToLocal and FVector::Length, so scores are identical to scoring candidates one by one, which the automation test checks.
+	 */
+	constexpr int32 NumLanes = 4;
+	float BestDistances[NumLanes];
+	int32 BestIndices[NumLanes];
+	for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+	{
+		BestDistances[Lane] = MAX_flt;
+		BestIndices[Lane] = INDEX_NONE;
+	}
+
+	auto ScoreCandidate = [&](int32 Index, int32 Lane)
+	{
+		const double DiffX = PositionsX[Index] - Frame.Position.X;
+		const double DiffY = PositionsY[Index] - Frame.Position.Y;
+		const double DiffZ = PositionsZ[Index] - Frame.Position.Z;
+		const double LocalX = DiffX * Frame.Forward.X + DiffY * Frame.Forward.Y + DiffZ * Frame.Forward.Z;
+		const double LocalY = DiffX * Frame.Right.X + DiffY * Frame.Right.Y + DiffZ * Frame.Right.Z;
+		const double LocalZ = DiffX * Frame.Up.X + DiffY * Frame.Up.Y + DiffZ * Frame.Up.Z;
+
+		const float Distance = FMath::Sqrt(LocalY * LocalY + LocalZ * LocalZ);
+		const bool bBetter = (LocalX > 0) & (LocalX <= MaxDistance) & (Distance < BestDistances[Lane]);
+		BestDistances[Lane] = bBetter ? Distance : BestDistances[Lane];
+		BestIndices[Lane] = bBetter ? Index : BestIndices[Lane];
+	};
+
+	const int32 NumCandidates = PositionsX.Num();
+	const int32 NumBlocked = NumCandidates - NumCandidates % NumLanes;
+	for (int32 Base = 0; Base < NumBlocked; Base += NumLanes)
+	{
+		for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+		{
+			ScoreCandidate(Base + Lane, Lane);
+		}
+	}
+	for (int32 Index = NumBlocked; Index < NumCandidates; ++Index)
+	{
+		ScoreCandidate(Index, Index - NumBlocked);
+	}
 
-	FVector LocalSpaceFollowPosition =
-		UKismetMathLibrary::MakeVector(ForwardVector.X, RightVector.X, UpVector.X) * Diff.X +
-		UKismetMathLibrary::MakeVector(ForwardVector.Y, RightVector.Y, UpVector.Y) * Diff.Y +
-		UKismetMathLibrary::MakeVector(ForwardVector.Z, RightVector.Z, UpVector.Z) * Diff.Z;
+	/** Reduce lanes. Break ties by index, matching a sequential scan with strict comparison. */
+	int32 BestLane = 0;
+	for (int32 Lane = 1; Lane < NumLanes; ++Lane)
+	{
+		if (BestIndices[Lane] == INDEX_NONE) continue;
+		if (BestIndices[BestLane] == INDEX_NONE || BestDistances[Lane] < BestDistances[BestLane]
+			|| (BestDistances[Lane] == BestDistances[BestLane] && BestIndices[Lane] < BestIndices[BestLane]))
+		{
+			BestLane = Lane;
+		}
+	}
 
-	return LocalSpaceFollowPosition;
+	OutScreenDistance = BestDistances[BestLane];
+	return BestIndices[BestLane];
 }
 
 AECameraBase* UECameraLibrary::CallCamera(const UObject* WorldContextObject,        // World context object.
@@ -0,0 +1,88 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#include "Utils/ECameraLookInputProcessor.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/PlatformTime.h"
+
+TSharedPtr<FECameraLookInputProcessor> FECameraLookInputProcessor::Instance;
+
+TSharedPtr<FECameraLookInputProcessor> FECameraLookInputProcessor::Get()
+{
+	if (!Instance.IsValid() && FSlateApplication::IsInitialized())
+	{
+		Instance = MakeShared<FECameraLookInputProcessor>();
+		FSlateApplication::Get().RegisterInputPreProcessor(Instance);
+	}
+	return Instance;
+}
+
+void FECameraLookInputProcessor::Shutdown()
+{
+	if (Instance.IsValid() && FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().UnregisterInputPreProcessor(Instance);
+	}
+	Instance.Reset();
+}
+
+void FECameraLookInputProcessor::Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor)
+{
+	StampPendingSamples();
+
+	/** Drop samples no camera will ask for anymore. */
+	const double OldestTime = LastPumpTime - SampleLifetime;
+	int32 NumExpired = 0;
+	while (NumExpired < Samples.Num() - NumPendingSamples && Samples[NumExpired].Time < OldestTime) ++NumExpired;
+	if (NumExpired > 0) Samples.RemoveAt(0, NumExpired, false);
+}
+
+bool FECameraLookInputProcessor::HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	const FVector2D Delta = MouseEvent.GetCursorDelta();
+	if (!Delta.IsZero())
+	{
+		Samples.Add(FECameraLookInputSample{ 0.0, Delta });
+		++NumPendingSamples;
+	}
+
+	/** Only observe, never consume. */
+	return false;
+}
+
+void FECameraLookInputProcessor::GetSamples(double StartTime, double EndTime, TArray<FECameraLookInputSample, TMemStackAllocator<>>& OutSamples)
+{
+	StampPendingSamples();
+
+	for (const FECameraLookInputSample& Sample : Samples)
+	{
+		if (Sample.Time > EndTime) break;
+		if (Sample.Time > StartTime) OutSamples.Add(Sample);
+	}
+}
+
+double FECameraLookInputProcessor::GetLatestTime()
+{
+	StampPendingSamples();
+	return LastPumpTime;
+}
+
+void FECameraLookInputProcessor::StampPendingSamples()
+{
+	const double Now = FPlatformTime::Seconds();
+	if (NumPendingSamples == 0)
+	{
+		LastPumpTime = Now;
+		return;
+	}
+
+	/** Real event times are not available, so evenly spaced times are synthesized. On the very first pump there is no previous one, so assume a typical frame. */
+	const double StartTime = LastPumpTime > 0.0 ? LastPumpTime : Now - 1.0 / 60.0;
+	const int32 FirstPending = Samples.Num() - NumPendingSamples;
+	for (int32 Index = 0; Index < NumPendingSamples; ++Index)
+	{
+		Samples[FirstPending + Index].Time = StartTime + (Now - StartTime) * (Index + 1) / NumPendingSamples;
+	}
+
+	NumPendingSamples = 0;
+	LastPumpTime = Now;
+}
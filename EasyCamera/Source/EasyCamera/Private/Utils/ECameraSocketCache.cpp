@@ -0,0 +1,72 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#include "Utils/ECameraSocketCache.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "GameFramework/Actor.h"
+
+FECameraSocketCache::FECameraSocketCache()
+{
+	ResolvedSocketName = NAME_None;
+	BoneIndex = INDEX_NONE;
+	SocketLocalTransform = FTransform::Identity;
+}
+
+bool FECameraSocketCache::Update(const AActor* Target, FName SocketName)
+{
+	if (Target == nullptr || SocketName == NAME_None)
+	{
+		Reset();
+		return false;
+	}
+
+	/** Mesh component may be destroyed or swap its skinned asset, both of which invalidate the bone index. */
+	const USkeletalMeshComponent* Mesh = MeshComponent.Get();
+	const bool bMeshChanged = Mesh != nullptr ? SkinnedAsset.Get() != Mesh->GetSkinnedAsset() : MeshComponent.IsStale();
+	if (ResolvedTarget.Get() != Target || ResolvedSocketName != SocketName || bMeshChanged)
+	{
+		ResolvedTarget = Target;
+		ResolvedSocketName = SocketName;
+		MeshComponent = Target->FindComponentByClass<USkeletalMeshComponent>();
+		Resolve();
+	}
+
+	return BoneIndex != INDEX_NONE;
+}
+
+FTransform FECameraSocketCache::GetTransform() const
+{
+	const USkeletalMeshComponent* Mesh = MeshComponent.Get();
+	if (Mesh == nullptr || BoneIndex == INDEX_NONE) return FTransform::Identity;
+
+	/** Bone transform is read from the mesh's component space transforms by index, which also handles leader pose components. */
+	return SocketLocalTransform * Mesh->GetBoneTransform(BoneIndex);
+}
+
+void FECameraSocketCache::Reset()
+{
+	ResolvedTarget.Reset();
+	MeshComponent.Reset();
+	SkinnedAsset.Reset();
+	ResolvedSocketName = NAME_None;
+	BoneIndex = INDEX_NONE;
+	SocketLocalTransform = FTransform::Identity;
+}
+
+void FECameraSocketCache::Resolve()
+{
+	BoneIndex = INDEX_NONE;
+	SocketLocalTransform = FTransform::Identity;
+
+	const USkeletalMeshComponent* Mesh = MeshComponent.Get();
+	SkinnedAsset = Mesh != nullptr ? Mesh->GetSkinnedAsset() : nullptr;
+	if (Mesh == nullptr || Mesh->GetSkinnedAsset() == nullptr) return;
+
+	/** Sockets are searched first, same as GetSocketTransform. */
+	if (const USkeletalMeshSocket* Socket = Mesh->GetSocketByName(ResolvedSocketName))
+	{
+		BoneIndex = Mesh->GetBoneIndex(Socket->BoneName);
+		if (BoneIndex != INDEX_NONE) SocketLocalTransform = Socket->GetSocketLocalTransform();
+	}
+	else BoneIndex = Mesh->GetBoneIndex(ResolvedSocketName);
+}
@@ -0,0 +1,159 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#include "Utils/ECameraSplineCache.h"
+
+FECameraSplineCache::FECameraSplineCache()
+{
+	SampleSpacing = 25.0f;
+	MaxSamples = 8192;
+	BakedVersion = 0;
+	Length = 0.0f;
+}
+
+bool FECameraSplineCache::Update(const USplineComponent* Spline)
+{
+	if (Spline == nullptr)
+	{
+		BakedSpline.Reset();
+		Locations.Reset();
+		Rotations.Reset();
+		Nodes.Reset();
+		return false;
+	}
+
+	const float SplineLength = Spline->GetSplineLength();
+	if (BakedSpline.Get() == Spline && BakedVersion == Spline->SplineCurves.Version && Length == SplineLength && Locations.Num() > 0) return true;
+
+	BakedSpline = Spline;
+	BakedVersion = Spline->SplineCurves.Version;
+	Length = SplineLength;
+
+	const int32 NumSamples = FMath::Clamp(FMath::CeilToInt(Length / FMath::Max(SampleSpacing, 1.0f)) + 1, 2, FMath::Max(MaxSamples, 2));
+	Locations.SetNumUninitialized(NumSamples);
+	Rotations.SetNumUninitialized(NumSamples);
+
+	/** The reparam table maps distance to input key, so each sample costs one table lookup and one curve evaluation. */
+	for (int32 Index = 0; Index < NumSamples; ++Index)
+	{
+		const float Distance = Length * Index / (NumSamples - 1);
+		const float InputKey = Spline->SplineCurves.ReparamTable.Eval(Distance, 0.0f);
+		Locations[Index] = Spline->GetLocationAtSplineInputKey(InputKey, ESplineCoordinateSpace::Local);
+		Rotations[Index] = Spline->GetQuaternionAtSplineInputKey(InputKey, ESplineCoordinateSpace::Local);
+	}
+
+	/** Samples are ordered along the spline, so splitting segment ranges in halves already gives spatially compact nodes. */
+	Nodes.Reset();
+	BuildNode(0, NumSamples - 1);
+
+	return true;
+}
+
+float FECameraSplineCache::FindFractionClosestToWorldLocation(const FVector& WorldLocation, float WarmStartFraction) const
+{
+	const USplineComponent* Spline = BakedSpline.Get();
+	if (Spline == nullptr || Nodes.Num() == 0) return 0.0f;
+
+	const FVector Location = Spline->GetComponentTransform().InverseTransformPosition(WorldLocation);
+	double BestDistSquared = TNumericLimits<double>::Max();
+	int32 BestSegment = 0;
+	float BestAlpha = 0.0f;
+
+	/** Warm start around last result. A tight initial bound lets the hierarchy reject almost every node. */
+	const int32 NumSegments = Locations.Num() - 1;
+	if (WarmStartFraction >= 0.0f && WarmStartFraction <= 1.0f)
+	{
+		const int32 WarmSegment = FMath::Min(FMath::FloorToInt(WarmStartFraction * NumSegments), NumSegments - 1);
+		const int32 WarmRadius = 2;
+		for (int32 Segment = FMath::Max(WarmSegment - WarmRadius, 0); Segment <= FMath::Min(WarmSegment + WarmRadius, NumSegments - 1); ++Segment)
+		{
+			TestSegment(Segment, Location, BestDistSquared, BestSegment, BestAlpha);
+		}
+	}
+
+	/** Traverse hierarchy, nearer child first, pruning nodes farther than the best segment found so far. */
+	TArray<int32, TInlineAllocator<64>> Stack;
+	Stack.Add(0);
+	while (Stack.Num() > 0)
+	{
+		const FSegmentNode& Node = Nodes[Stack.Pop(false)];
+		if (Node.Bounds.ComputeSquaredDistanceToPoint(Location) >= BestDistSquared) continue;
+
+		if (Node.Children[0] == INDEX_NONE)
+		{
+			for (int32 Segment = Node.First; Segment < Node.First + Node.Count; ++Segment)
+			{
+				TestSegment(Segment, Location, BestDistSquared, BestSegment, BestAlpha);
+			}
+			continue;
+		}
+
+		const double DistSquared0 = Nodes[Node.Children[0]].Bounds.ComputeSquaredDistanceToPoint(Location);
+		const double DistSquared1 = Nodes[Node.Children[1]].Bounds.ComputeSquaredDistanceToPoint(Location);
+		Stack.Add(DistSquared0 <= DistSquared1 ? Node.Children[1] : Node.Children[0]);
+		Stack.Add(DistSquared0 <= DistSquared1 ? Node.Children[0] : Node.Children[1]);
+	}
+
+	return (BestSegment + BestAlpha) / NumSegments;
+}
+
+FTransform FECameraSplineCache::GetTransformAtFraction(float Fraction) const
+{
+	const USplineComponent* Spline = BakedSpline.Get();
+	if (Spline == nullptr || Locations.Num() == 0) return FTransform();
+
+	int32 Index;
+	float Alpha;
+	GetSampleAtFraction(Fraction, Index, Alpha);
+
+	const FVector LocalLocation = FMath::Lerp(Locations[Index], Locations[Index + 1], Alpha);
+	const FQuat LocalRotation = FQuat::Slerp(Rotations[Index], Rotations[Index + 1], Alpha);
+
+	const FTransform& ComponentTransform = Spline->GetComponentTransform();
+	return FTransform(ComponentTransform.GetRotation() * LocalRotation, ComponentTransform.TransformPosition(LocalLocation));
+}
+
+int32 FECameraSplineCache::BuildNode(int32 First, int32 Count)
+{
+	const int32 NodeIndex = Nodes.AddUninitialized();
+	FBox Bounds(ForceInit);
+	for (int32 Index = First; Index <= First + Count; ++Index) Bounds += Locations[Index];
+
+	int32 Children[2] = { INDEX_NONE, INDEX_NONE };
+	if (Count > MaxLeafSegments)
+	{
+		const int32 HalfCount = Count / 2;
+		Children[0] = BuildNode(First, HalfCount);
+		Children[1] = BuildNode(First + HalfCount, Count - HalfCount);
+	}
+
+	/** Nodes may have been reallocated while building children, so only write to this node afterwards. */
+	FSegmentNode& Node = Nodes[NodeIndex];
+	Node.Bounds = Bounds;
+	Node.First = First;
+	Node.Count = Count;
+	Node.Children[0] = Children[0];
+	Node.Children[1] = Children[1];
+	return NodeIndex;
+}
+
+void FECameraSplineCache::TestSegment(int32 Segment, const FVector& Location, double& BestDistSquared, int32& BestSegment, float& BestAlpha) const
+{
+	const FVector& Start = Locations[Segment];
+	const FVector SegmentVector = Locations[Segment + 1] - Start;
+	const double SegmentLengthSquared = SegmentVector.SizeSquared();
+	const double Alpha = SegmentLengthSquared > UE_SMALL_NUMBER ? FMath::Clamp(((Location - Start) | SegmentVector) / SegmentLengthSquared, 0.0, 1.0) : 0.0;
+	const double DistSquared = FVector::DistSquared(Location, Start + SegmentVector * Alpha);
+	if (DistSquared < BestDistSquared)
+	{
+		BestDistSquared = DistSquared;
+		BestSegment = Segment;
+		BestAlpha = Alpha;
+	}
+}
+
+void FECameraSplineCache::GetSampleAtFraction(float Fraction, int32& OutIndex, float& OutAlpha) const
+{
+	const float Position = FMath::Clamp(Fraction, 0.0f, 1.0f) * (Locations.Num() - 1);
+	OutIndex = FMath::Min(FMath::FloorToInt(Position), Locations.Num() - 2);
+	OutAlpha = Position - OutIndex;
+}
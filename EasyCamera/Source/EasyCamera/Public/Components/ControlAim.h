@@ -80,6 +80,14 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
 	FVector2f VerticalDamping;
 
+	/** Whether to integrate look input at sub-frame resolution, using raw mouse samples collected between frames.
+	 *  Magnitude still comes from the input above, so sensitivity and input modifiers apply. Only the distribution within a frame comes from raw samples.
+	 *  NOTE: the engine does not report when each mouse event happened. Samples of one frame are spread evenly over it, so their timing is synthesized,
+	 *  and the gain over frame-based damping is mainly that damping runs in real time on input rate, keeping camera response consistent across frame rates.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bSubFrameInput;
+
 	/** Whether to replicate camera's rotation to Controller. This is useful when you want to set character's rotation in synchronization with this camera. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	bool bSyncToController;
@@ -90,8 +98,13 @@ protected:
 	/** Cached scaled mouse delta X and Y. */
 	float CachedMouseDeltaX;
 	float CachedMouseDeltaY;
+	/** Damped look rate, in degrees per second, and platform time up to which look input has been integrated. Used by sub-frame input. */
+	FVector2D LookRate;
+	double LookInputTime;
 	/** Already wait time. */
 	float WaitElaspedTime;
+	/** Frame whose input was applied by late update. The regular tick of that frame then skips applying input. */
+	uint64 LateIntegratedFrame;
 
 	/** If currently is in aim assist. */
 	bool bInAimAssist;
@@ -107,6 +120,7 @@ protected:
 	
 public:
 	virtual void UpdateComponent_Implementation(float DeltaTime) override;
+	virtual void LateUpdateComponent(float DeltaTime) override;
 	virtual void ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserveState) override;
 
 	/** Get input mouse delta. */
@@ -125,9 +139,18 @@ public:
 	/** Return AimAsset for HUD. */
 	const FAimAssist& GetAimAssist() { return AimAssist; }
 
+	/** Scale, damp and constrain this frame's input, then apply it to camera rotation. */
+	void ApplyLookInput(float DeltaTime);
+
 	/** Get damped mouse delta. */
 	float GetDampedMouseDelta(const float& MouseDelta, bool bIsHorizontal, const float& DeltaTime);
 
+	/** Integrate this frame's speed-scaled input at sub-frame resolution, returning damped yaw and pitch deltas to apply in this frame. */
+	void IntegrateSubFrameInput(float MouseDeltaX, float MouseDeltaY, float DeltaTime, float& OutDeltaX, float& OutDeltaY);
+
+	/** Integrate one axis of damped look rate over a list of input segments. Each segment is a duration and an input delta. */
+	float IntegrateLookAxis(double& Rate, TArrayView<const FVector2D> Segments, const FVector2f& Damping);
+
 	/** Resolve recentering. Returns whether camera is currently recentering. */
 	bool ResolveRecentering(const float& DeltaTime);
 
@@ -21,10 +21,26 @@ public:
 	UCraneFollow();
 	
 protected:
-	/** The crane along which camera moves. */
+	/** The crane along which camera moves. If bRigless is true, it is only used to initialize CraneBase and is not updated at runtime. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TSoftObjectPtr<ACameraRig_Crane> Crane;
 
+	/** Whether to evaluate the crane directly from CraneBase and limits below, without writing to or ticking a crane rig actor. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bRigless;
+
+	/** Crane base transform when bRigless is true. Crane yaw and pitch are relative to it. Overridden by Crane's transform if Crane is set. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bRigless == true"))
+	FTransform CraneBase;
+
+	/** Arm length range when bRigless is true. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0", EditCondition = "bRigless == true"))
+	FVector2f ArmLengthRange;
+
+	/** Crane pitch range when bRigless is true. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "-180.0", ClampMax = "180.0", EditCondition = "bRigless == true"))
+	FVector2f PitchRange;
+
 	/** Determines whether the camera should be oriented outwards in the direction from crane origin to camera position.
 	 *  You should not specify AimComponent if you are enabling this.
 	 */
@@ -88,12 +104,25 @@ protected:
 	/** Crane location, for HUD. */
 	FVector CraneLocation;
 
+	/** Arm length, yaw and pitch of the crane when bRigless is true. */
+	FVector CraneState;
+
 public:
 	virtual void UpdateComponent_Implementation(float DeltaTime) override;
+	virtual void ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserveState) override;
 
 	/** Get crane location. */
 	FVector GetCraneLocation() { return CraneLocation; }
 	
+	/** Get arm length, yaw and pitch of the crane. */
+	FVector GetCraneState() const;
+
+	/** Set arm length, yaw and pitch of the crane. Limits are applied when bRigless is true. */
+	void SetCraneState(const FVector& InCraneState);
+
+	/** Get crane base transform. */
+	FTransform GetCraneBase() const;
+
 	/** Get camera position on crane. */
 	FTransform UpdateTransformOnCrane();
 
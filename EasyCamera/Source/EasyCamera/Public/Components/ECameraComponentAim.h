@@ -38,7 +38,7 @@ public:
 	virtual FVector GetRealAimPosition() 
 	{ 
 		if (AimTarget != nullptr)
-			return AimTarget->GetActorLocation();
+			return GetTargetKinematics(AimTarget.Get()).Position;
 		else return GetOwningActor()->GetActorLocation();
 	}
 };
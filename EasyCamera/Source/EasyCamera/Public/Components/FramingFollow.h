@@ -41,6 +41,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0", ClampMax = "5.0"))
 	FVector FollowDamping;
 
+	/** Extrapolate follow position to compensate for damping lag on fast moving targets. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FPredictionParams Prediction;
+
 	/** Screen space offset applied to the *real* follow target after applying FollowOffset. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "-0.5", ClampMax = "0.5"))
 	FVector2f ScreenOffset;
@@ -70,6 +74,13 @@ protected:
 
 	FVector ExactSpringVel;
 
+	/** Field of view TanHalfFOV was computed for. */
+	float CachedFieldOfView;
+	/** Tangent of half the horizontal field of view. */
+	double TanHalfFOV;
+	/** Reciprocal of camera aspect ratio. */
+	double InvAspectRatio;
+
 public:
 	virtual void UpdateComponent_Implementation(float DeltaTime) override;
 
@@ -94,16 +105,19 @@ public:
 	/** Normalize pitch into [-90, 90]. */
 	float NormalizePitch(float Pitch);
 
+	/** Refresh cached projection terms. Tangent is only recomputed when field of view changes. */
+	void UpdateProjection();
+
 	/** Set delta position along the local X axis. */
 	void SetForwardDelta(const FVector& LocalSpaceFollowPosition, FVector& TempDeltaPosition, float RealCameraDistance);
 
-	/** Damp delta x and apply it. */
-	void ApplyForwardDelta(FVector& TempDeltaPosition, float DeltaTime);
+	/** Damp delta x without applying it. Returns the damped delta x. */
+	double DampForwardDelta(const FVector& TempDeltaPosition, float DeltaTime);
 
 	/** Get delta position along the local YZ plane. */
 	void SetYZPlaneDelta(const FVector& LocalSpaceFollowPosition, FVector& TempDeltaPosition, const FVector2f& RealScreenOffset);
 
-	/** Damp temporary delta position. */
+	/** Damp temporary delta position on the local YZ plane. */
 	FVector DampDeltaPosition(const FVector& LocalSpaceFollowPosition, const FVector& TempDeltaPosition, float DeltaTime, const FVector2f& RealScreenOffset);
 
 	/** Ensure after damping, the follow target will be within the bound. */
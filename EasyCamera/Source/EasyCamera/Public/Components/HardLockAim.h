@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ECameraComponentAim.h"
 #include "Utils/ECameraLibrary.h"
+#include "UObject/ObjectKey.h"
 #include "HardLockAim.generated.h"
 
 /**
@@ -42,6 +43,32 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0", ClampMax = "20.0", EditCondition = "bUseQuatDamping == true"))
 	float QuatDamping;
 
+	/** Whether to inherit aim target's rotation through the scene graph, instead of setting camera rotation every tick. 
+	 *  Only takes effect when no damping is applied and camera is attached to aim target's root component without a socket, e.g., by HardLockFollow with the same target.
+	 *  Rotation offset is then relative to the root component, i.e., to aim target's rotation, exactly as when not attached. Attached to a socket, rotation is set every tick instead.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bAttachToTarget;
+
+	/** Desired rotation used in last update, with the frame and aim target it was used for. Late update in the next frame only patches that update. */
+	FQuat AppliedDesiredQuat;
+	uint64 AppliedFrame;
+	TObjectKey<AActor> AppliedTarget;
+
+	/** Whether camera currently inherits rotation from its attach parent. */
+	bool bInheritingRotation;
+
 public:
 	virtual void UpdateComponent_Implementation(float DeltaTime) override;
+	virtual void LateUpdateComponent(float DeltaTime) override;
+	virtual void ResetOnEndViewTarget(APlayerController* PC) override;
+
+	/** Whether camera rotation exactly follows aim target, i.e., no damping is applied. */
+	bool IsUndamped() const;
+
+	/** Whether rotation can be inherited from the scene graph in current state. */
+	bool CanInheritRotation();
+
+	/** Stop inheriting rotation from attach parent, keeping camera's world rotation. */
+	void StopInheritingRotation();
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ECameraComponentFollow.h"
+#include "UObject/ObjectKey.h"
 #include "HardLockFollow.generated.h"
 
 /**
@@ -22,6 +23,45 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FVector FollowOffset;
 
+	/** Whether to attach camera to follow target through the scene graph, instead of setting camera location every tick. 
+	 *  Camera then moves in lockstep with follow target's own transform update. Rotation is not inherited unless HardLockAim also attaches to the same target.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bAttachToTarget;
+
+	/** Socket or bone on follow target to attach to. If none or not found, attach to follow target's root component.
+	 *  Follow offset is then in the socket's space rather than follow target's, while scale of the socket is still compensated.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bAttachToTarget"))
+	FName AttachSocketName;
+
+	/** Follow position applied in last update, with the frame and follow target it was applied for. Late update in the next frame only patches that update. */
+	FVector AppliedFollowPosition;
+	uint64 AppliedFrame;
+	TObjectKey<AActor> AppliedTarget;
+
+	/** Component camera is currently attached to, and the socket name it was resolved with. */
+	TWeakObjectPtr<USceneComponent> AttachParent;
+	FName AttachedSocketName;
+	bool bAttached;
+
 public:
 	virtual void UpdateComponent_Implementation(float DeltaTime) override;
+	virtual void LateUpdateComponent(float DeltaTime) override;
+	virtual void ResetOnEndViewTarget(APlayerController* PC) override;
+
+	/** Get follow position derived from follow target's current transform. */
+	FVector GetFollowPosition() const;
+
+	/** Whether camera is currently attached to follow target. */
+	bool IsAttachedToTarget() const { return bAttached && AttachParent.IsValid(); }
+
+	/** Attach camera to follow target's socket or root component, with follow offset as relative location. */
+	void AttachToTarget();
+
+	/** Follow offset as relative location to the attach parent, compensating for its world scale so that the offset is not stretched. */
+	FVector GetAttachedRelativeLocation();
+
+	/** Detach camera from follow target, keeping its world transform. */
+	void DetachFromTarget();
 };
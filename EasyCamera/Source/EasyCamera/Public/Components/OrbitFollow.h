@@ -30,12 +30,13 @@ protected:
 	 *  For example, if you have two orbits respectively with height 1.0 (Orbit A) and 2.0 (Orbit B), 
 	 *  then you should place Orbit B at index 0 and Orbit A at index 1 in the array.
 	 *  Orbits should satisfy: Orbits[0].Height >= Orbits[1].Height >= Orbits[2].Height >= ...
+	 *  Orbits are baked into a radius table, so setting them from Blueprint goes through SetOrbits. From C++, call SetOrbits rather than editing elements in place at runtime.
 	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetOrbits)
 	TArray<FOrbit> Orbits;
 
 	/** The function used to blend between orbits. Default is Linear. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetBlendFunction)
 	TEnumAsByte<EEasingFunc::Type> BlendFunction;
 
 	/** Damp parameters you want to use for follow damping. */
@@ -46,6 +47,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0", ClampMax = "5.0"))
 	FVector FollowDamping;
 
+	/** Extrapolate follow position to compensate for damping lag on fast moving targets. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FPredictionParams Prediction;
+
 	/** Current camera root position. */
 	FVector CurrentRootPosition;
 	/** Cached camera root position. Used for spring damping. */
@@ -57,12 +62,35 @@ protected:
 	/** Current camera radius. */
 	float Radius;
 
+	/** Radius baked at evenly spaced heights from the lowest to the highest orbit, with blend function applied. */
+	TArray<float> RadiusTable;
+	/** Height of the first table entry, and height step between entries. */
+	float RadiusTableMinHeight;
+	float RadiusTableHeightStep;
+	/** Number of orbits and blend function the table was baked with, to catch changes made without SetOrbits. */
+	int32 BakedNumOrbits;
+	TEnumAsByte<EEasingFunc::Type> BakedBlendFunction;
+
+	/** Number of entries in baked radius table. */
+	static constexpr int32 RadiusTableSize = 256;
+
 public:
 	virtual void UpdateComponent_Implementation(float DeltaTime) override;
 	virtual void ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserveState) override;
 
 	/** Get orbits. */
-	TArray<FOrbit>& GetOrbits() { return Orbits; }
+	const TArray<FOrbit>& GetOrbits() const { return Orbits; }
+
+	/** Set orbits and rebake radius table. Orbits should be in descending order of height. */
+	UFUNCTION(BlueprintCallable, Category = "ECamera|OrbitFollow")
+	void SetOrbits(const TArray<FOrbit>& InOrbits);
+
+	/** Set blend function and rebake radius table. */
+	UFUNCTION(BlueprintCallable, Category = "ECamera|OrbitFollow")
+	void SetBlendFunction(TEnumAsByte<EEasingFunc::Type> InBlendFunction);
+
+	/** Bake radius table from Orbits and BlendFunction. */
+	void BakeRadiusTable();
 
 	/** Get damped delta position. */
 	FVector DampDeltaPosition(const FVector& TempDeltaPosition, float DeltaTime);
@@ -73,9 +101,17 @@ public:
 	/** Constrain height. */
 	float ConstrainHeight(float InputHeight);
 
-	/** Get radius according to height. */
+	/** Get radius according to height, by searching orbits. Used to bake radius table. */
+	float EvaluateRadiusAtHeight(float InHeight) const;
+
+	/** Get radius according to height, from baked radius table. */
 	void EvaluateRadius();
 
-	/** Get world space offset. */
-	FVector GetOrbitOffset();
+	/** Solve camera location and rotation on orbit surface in closed form, given root position, current Height and Radius, and camera yaw. */
+	FTransform SolveOrbitPose(const FVector& RootPosition, float Yaw) const;
+
+public:
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
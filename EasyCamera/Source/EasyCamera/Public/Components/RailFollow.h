@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ECameraComponentFollow.h"
+#include "Utils/ECameraSplineCache.h"
 #include "RailFollow.generated.h"
 
 class ACameraRig_Rail;
@@ -95,17 +96,23 @@ protected:
 	/** Current key point, for Manual mode. */
 	int CurrentKeyPoint;
 
+	/** Position on rail nearest to follow target in last frame, used to warm start the next query. Negative if unknown. */
+	float NearestPositionOnRail;
+
+	/** Rail spline baked at even distances. Positions on rail are always fractions of rail length. */
+	FECameraSplineCache RailCache;
+
 public:
 	virtual void UpdateComponent_Implementation(float DeltaTime) override;
 	virtual void ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserveState) override;
 
-	/** Get camera position on rail. Code is basically copied from CameraRig_Rail.cpp. */
+	/** Get camera position on rail, evaluated from baked rail samples. */
 	FTransform UpdateTransformOnRail();
 
 	/** Set rail position and update camera transform. */
 	void SetRailPositionAndUpdateCameraTransform(float Position);
 
-	/** Get normalized position on rail nearest to target */
+	/** Get normalized position on rail nearest to target, as a fraction of rail length. */
 	float GetNormalizedPositionOnRailNearestToTarget(AActor* Target);
 
 	/** Get damped delta location from current location to desired position on rail. */
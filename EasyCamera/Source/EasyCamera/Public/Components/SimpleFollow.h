@@ -24,7 +24,7 @@ protected:
 	 *  If this field is empty, the camera will still track the follow target's root transform. 
 	 */ 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	FString SocketName;
+	FName SocketName;
 
 	/** How do you want to follow the target. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
@@ -51,6 +51,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0", ClampMax = "5.0"))
 	FVector FollowDamping;
 
+	/** Extrapolate follow position to compensate for damping lag on fast moving targets. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FPredictionParams Prediction;
+
 	FVector PreviousLocation;
 	FVector ExactSpringVel;
 
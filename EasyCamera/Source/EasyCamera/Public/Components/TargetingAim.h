@@ -36,6 +36,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0", ClampMax = "5.0"))
 	FVector AimDamping;
 
+	/** Extrapolate aim position to compensate for damping lag on fast moving targets. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FPredictionParams Prediction;
+
 	/** Screen space offset applied to the *real* aim target after applying AimOffset. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "-0.5", ClampMax = "0.5"))
 	FVector2f ScreenOffset;
@@ -50,11 +54,21 @@ protected:
 
 	FVector RealAimPosition;
 
+	/** Field of view and aspect ratio the cached angular extents were computed for. */
+	float CachedFieldOfView;
+	float CachedAspectRatio;
+	/** Horizontal and vertical field of view, in degrees. */
+	double HFieldOfView;
+	double VFieldOfView;
+
+	/** Camera elevation above the horizon in current update, in degrees. Only used in world space rotation. */
+	double CameraElevation;
+
 public:
 	virtual void UpdateComponent_Implementation(float DeltaTime) override;
 
 	/** Get the *real* aim position, based on world space. */
-	virtual FVector GetRealAimPosition() override { return AimTarget->GetActorLocation() + AimOffset; }
+	virtual FVector GetRealAimPosition() override { return GetTargetKinematics(AimTarget.Get()).Position + AimOffset + GetPredictedOffset(AimTarget.Get(), Prediction); }
 
 	/** Get the real aim position. */
 	FVector GetAimPosition() { return RealAimPosition; }
@@ -71,12 +85,18 @@ public:
 	/** Check if camera is too close to the aim target. */
 	bool CheckIfTooClose(const FVector& AimPosition);
 
-	/** Set delta rotation. */
-	void SetDeltaRotation(const FVector& AimPosition, FRotator& TempDeltaRotation);
+	/** Refresh cached angular extents of the view. Only recomputed when field of view or aspect ratio changes. */
+	void UpdateFieldOfView();
+
+	/** Get yaw (X) and pitch (Y) in degrees from camera forward to the aim position, as a twist about the up axis followed by a swing about the right axis. */
+	FVector2D GetCenteredDeltaAngles(const FVector& AimPosition);
 
-	/** Damp delta rotation. */
-	FRotator DampDeltaRotation(const FRotator& TempDeltaRotation, float DeltaTime, const FVector& AimPosition);
+	/** Damp yaw and pitch delta angles independently. */
+	FVector2D DampDeltaAngles(const FVector2D& TempDeltaAngles, float DeltaTime) const;
 
 	/** Ensure after damping, the aim target will be within the bound. */
-	void EnsureWithinBounds(FRotator& DampedDeltaRotation, const FVector& AimPosition);
+	void EnsureWithinBounds(const FVector2D& CenteredDeltaAngles, FVector2D& DampedDeltaAngles) const;
+
+	/** Rotate by yaw and pitch delta angles. Yaw is applied about world up, or local up if using local space rotation. */
+	FQuat ApplyDeltaAngles(const FQuat& Rotation, const FVector2D& DeltaAngles) const;
 };
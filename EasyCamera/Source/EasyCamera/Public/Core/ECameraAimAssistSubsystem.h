@@ -0,0 +1,125 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "UObject/ObjectKey.h"
+#include "Misc/MemStack.h"
+#include "Utils/ECameraTypes.h"
+#include "ECameraAimAssistSubsystem.generated.h"
+
+class UECameraAimAssistTargetComponent;
+
+/**
+ * Keeps aim assist candidates of a world in contiguous arrays, so ControlAim only iterates relevant actors instead of scanning the whole world.
+ * Candidates come from UECameraAimAssistTargetComponent, which registers itself, and from actor types listed in FAimAssist::TargetTypes,
+ * which are scanned once when first requested and then kept up to date on actor spawn and level streaming.
+ * Candidates are also bucketed into a uniform grid, re-bucketed only when their root component moves, so that queries only visit nearby cells.
+ */
+UCLASS()
+class EASYCAMERA_API UECameraAimAssistSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UECameraAimAssistSubsystem();
+
+	virtual void Deinitialize() override;
+
+	/** Register a candidate owned by a target component. */
+	void RegisterTarget(UECameraAimAssistTargetComponent* Component, AActor* Actor, const FVector& Offset);
+
+	/** Unregister a candidate owned by a target component. */
+	void UnregisterTarget(UECameraAimAssistTargetComponent* Component);
+
+	/** Update offset of a candidate owned by a target component. */
+	void SetTargetOffset(UECameraAimAssistTargetComponent* Component, const FVector& Offset);
+
+	/** Start tracking given target types if not yet tracked, and mark which tracked types are relevant to them.
+	 *  Candidates whose type index is INDEX_NONE come from target components and are always relevant.
+	 */
+	void GetRelevantTypes(const TArray<FOffsetActorType>& TargetTypes, TBitArray<>& OutRelevantTypes);
+
+	/** Remove candidates whose actor has been destroyed and re-bucket moved ones. Does the work at most once per frame. */
+	void PruneCandidates();
+
+	/** Gather indices of candidates that may lie within a cylinder of given radius, starting at Start and extending Length along unit Direction.
+	 *  Result is conservative, so callers still need to test each candidate exactly.
+	 */
+	void QueryCylinder(const FVector& Start, const FVector& Direction, double Length, double Radius, TArray<int32, TMemStackAllocator<>>& OutIndices);
+
+	/** Edge length of grid cells. */
+	double CellSize;
+
+	int32 GetNumCandidates() const { return Actors.Num(); }
+	TArrayView<const TWeakObjectPtr<AActor>> GetCandidateActors() const { return Actors; }
+	TArrayView<const FVector> GetCandidateOffsets() const { return Offsets; }
+	TArrayView<const int32> GetCandidateTypes() const { return Types; }
+
+	/** Cached world space candidate positions, with offsets applied. Up to date after PruneCandidates or QueryCylinder. */
+	TArrayView<const double> GetCandidatePositionsX() const { return PositionsX; }
+	TArrayView<const double> GetCandidatePositionsY() const { return PositionsY; }
+	TArrayView<const double> GetCandidatePositionsZ() const { return PositionsZ; }
+
+protected:
+	/** Add a candidate, returning its index. */
+	int32 AddCandidate(AActor* Actor, const FVector& Offset, int32 TypeIndex, TObjectKey<UECameraAimAssistTargetComponent> Source);
+
+	/** Remove candidate at Index, swapping the last candidate into its place. */
+	void RemoveCandidateAt(int32 Index);
+
+	/** Get candidate's current world position, i.e., its actor's location with local offset, read from the actor. */
+	FVector GetCandidatePosition(int32 Index) const;
+
+	/** Get grid cell containing Position. */
+	FIntVector GetCell(const FVector& Position) const;
+
+	/** Refresh cached position of candidate at Index and move it to the cell containing that position. */
+	void UpdateCandidatePosition(int32 Index);
+
+	/** Re-bucket candidates whose root component moved since last flush. */
+	void FlushMovedCandidates();
+
+	void OnRootComponentMoved(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** Add actor as a candidate of each tracked type it belongs to. */
+	void AddActorOfTrackedTypes(AActor* Actor);
+
+	void OnActorSpawned(AActor* Actor);
+	void OnLevelAdded(ULevel* Level, UWorld* World);
+
+	/** Candidates, stored as structure of arrays. */
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<FVector> Offsets;
+	TArray<int32> Types;
+	TArray<TObjectKey<UECameraAimAssistTargetComponent>> Sources;
+	TArray<TObjectKey<USceneComponent>> Roots;
+	TArray<FIntVector> Cells;
+	TArray<double> PositionsX;
+	TArray<double> PositionsY;
+	TArray<double> PositionsZ;
+
+	/** Candidate indices in each non-empty grid cell. */
+	TMap<FIntVector, TArray<int32>> Grid;
+
+	/** Candidate indices of each watched root component, and the watched component with its TransformUpdated binding. */
+	TMultiMap<TObjectKey<USceneComponent>, int32> RootCandidates;
+	TMap<TObjectKey<USceneComponent>, TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>> RootBindings;
+
+	/** Root components that moved since last flush. */
+	TSet<TObjectKey<USceneComponent>> MovedRoots;
+
+	/** Maps each registered target component to its candidate index. */
+	TMap<TObjectKey<UECameraAimAssistTargetComponent>, int32> SourceIndices;
+
+	/** Actor types tracked so far. */
+	TArray<FOffsetActorType> TrackedTypes;
+
+	/** Frame in which candidates were last pruned. */
+	uint64 PrunedFrame;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle LevelAddedHandle;
+};
@@ -8,6 +8,7 @@
 #include "UObject/NoExportTypes.h"
 #include "Core/ECameraBase.h"
 #include "Utils/ECameraTypes.h"
+#include "Utils/ECameraSocketCache.h"
 #include "Kismet/GameplayStatics.h"
 #include "ECameraComponentBase.generated.h"
 
@@ -35,6 +36,9 @@ protected:
 	UPROPERTY(BlueprintReadOnly)
 	UECameraSettingsComponent* OwningSettingComponent;
 
+	/** Socket resolved by GetTargetSocketTransform. */
+	FECameraSocketCache SocketCache;
+
 public:
 	/** Get stage at which this component is executed in the camera pipeline. */
 	EStage GetStage() const { return Stage; }
@@ -54,6 +58,20 @@ public:
 	/** Get the `ECameraOwningSettingsComponent` that owns this component. */
 	UECameraSettingsComponent* GetOwningSettingComponent() { return OwningSettingComponent;	}
 
+	/** Get the camera frame cached by the owning settings component right before this component is updated. */
+	const FECameraFrame& GetCameraFrame() const { return OwningSettingComponent->GetCameraFrame(); }
+
+	/** Get kinematics of a target in current frame, shared among all cameras through the target subsystem. */
+	FECameraTargetKinematics GetTargetKinematics(const AActor* Target) const;
+
+	/** Get the offset from a target's current position to its predicted position. Zero if prediction is disabled. */
+	FVector GetPredictedOffset(const AActor* Target, const FPredictionParams& PredictionParams) const;
+
+	/** Get world space transform of a socket or bone on target's skeletal mesh. Name lookups only happen when target, socket or mesh changes.
+	 *  Returns false and target's own transform if SocketName is none or cannot be found.
+	 */
+	bool GetTargetSocketTransform(const AActor* Target, FName SocketName, FTransform& OutTransform);
+
 	void SetOwningActor(AActor* NewOwningActor) { OwningActor = NewOwningActor; }
 	void SetOwningCamera(AECameraBase* NewOwningCamera) { OwningCamera = NewOwningCamera; }
 	void SetOwningSettingComponent(UECameraSettingsComponent* NewOwningSettingComponent) { OwningSettingComponent = NewOwningSettingComponent; }
@@ -85,6 +103,11 @@ public:
 	void UpdateComponent(float DeltaTime);
 	virtual void UpdateComponent_Implementation(float DeltaTime) {}
 
+	/** Patch this component's result against latest target transforms or input right before view setup, which happens before the regular tick of the same frame.
+	 *  Only called if the owning settings component enables late update. Only components whose result can be cheaply patched implement this.
+	 */
+	virtual void LateUpdateComponent(float DeltaTime) { }
+
 	/** You can implement this function to define what this component will do before any component executes in one tick. */
 	UFUNCTION(BlueprintImplementableEvent, meta = (DisplayName = "OnPreTickComponent"))
 	void K2_BindToOnPreTickComponent();
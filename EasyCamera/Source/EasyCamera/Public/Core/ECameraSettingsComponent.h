@@ -6,6 +6,7 @@
 #include "UObject/ScriptInterface.h"
 #include "Templates/SubclassOf.h"
 #include "Components/SceneComponent.h"
+#include "UObject/ObjectKey.h"
 #include "Utils/ECameraTypes.h"
 #include "ECameraSettingsComponent.generated.h"
 
@@ -42,6 +43,7 @@ public:
 
 public:
 	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -56,6 +58,13 @@ protected:
 	UPROPERTY(Instanced, EditAnywhere, BlueprintReadOnly, Category = "ECamera|Extension")
 	TArray<TObjectPtr<UECameraExtensionBase>> Extensions;
 
+	/** Whether to patch the camera pose right before view setup, using latest target transforms and look input.
+	 *  Camera manager sets up the view before this component ticks in the same frame, so the viewed pose is otherwise one frame old.
+	 *  Hard-lock components re-apply last update against the latest target transforms, and ControlAim applies this frame's look input early, which its regular tick then skips.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ECamera|Settings")
+	bool bLateUpdate;
+
 protected:
 	/** ComponentContainer only contains follow component and aimcomponent, excluding extensions. */
 	TArray<TObjectPtr<UECameraComponentBase>> ComponentContainer;
@@ -69,6 +78,20 @@ protected:
 	UPROPERTY(BlueprintReadOnly)
 	TObjectPtr<AECameraManager> ECameraManager;
 
+	/** Camera frame cached before each component is updated in one tick. */
+	FECameraFrame CameraFrame;
+
+	/** Targets currently registered to the target subsystem. */
+	TObjectKey<AActor> RegisteredFollowTarget;
+	TObjectKey<AActor> RegisteredAimTarget;
+
+	/** Frame in which late update last ran. */
+	uint64 LateUpdateFrame;
+
+	/** Actors and components this component currently waits for before ticking. Only those ticking in the same tick group or later are included. */
+	TArray<TWeakObjectPtr<AActor>> TickPrerequisiteActors;
+	TArray<TWeakObjectPtr<UActorComponent>> TickPrerequisiteComponents;
+
 
 public:
 	FOnPreTickComponent OnPreTickComponent;
@@ -125,7 +148,24 @@ public:
 	UECameraComponentAim* GetAimComponent() const;
 
 	/** Get Extensions. */
-	TArray<UECameraExtensionBase*> GetExtensions() const;
+	const TArray<TObjectPtr<UECameraExtensionBase>>& GetExtensions() const { return Extensions; }
+
+	/** Get the camera frame cached in current tick. */
+	const FECameraFrame& GetCameraFrame() const { return CameraFrame; }
+
+	/** Rebuild the cached camera frame from owner's current transform. */
+	void UpdateCameraFrame();
+
+	/** Re-evaluate follow and aim components against latest input and target transforms. Called by AEPlayerCameraManager before view setup. */
+	void LateUpdate(float DeltaTime);
+
+	/** Register current follow and aim targets to the target subsystem, unregistering stale ones. */
+	void RefreshTargetRegistration();
+
+	/** Make this component tick after follow and aim targets (and their movement and skeletal mesh components) that tick in the same tick group or later.
+	 *  Earlier tick groups have always completed by then. Tick groups are read when targets change, so call this after changing a target's tick group.
+	 */
+	void RefreshTickPrerequisites();
 
 public:
 	/** Register ECamaraManager */
@@ -0,0 +1,55 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Utils/ECameraTypes.h"
+#include "ECameraTargetSubsystem.generated.h"
+
+/**
+ * Shares follow and aim target kinematics among all cameras in a world.
+ * Each registered target is sampled at most once per frame, on first query, and stored as structure of arrays.
+ * Velocity and acceleration are estimated by filtered finite difference, so they are valid for kinematic and non-physics actors as well.
+ */
+UCLASS()
+class EASYCAMERA_API UECameraTargetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UECameraTargetSubsystem();
+
+	/** Register a target. Targets are reference counted, so each call should be paired with UnregisterTarget. */
+	void RegisterTarget(AActor* Target);
+
+	/** Unregister a target previously registered. Takes a key so that targets already destroyed can still be unregistered. */
+	void UnregisterTarget(TObjectKey<AActor> TargetKey);
+
+	/** Get kinematics of target in current frame. Targets not registered are sampled directly, using GetVelocity and zero acceleration. */
+	FECameraTargetKinematics GetKinematics(const AActor* Target);
+
+	/** Time constant, in seconds, of the low-pass filter applied to estimated velocity and acceleration. Zero disables filtering. */
+	float FilterTimeConstant;
+
+protected:
+	/** Sample target at Index if it has not been sampled in current frame. */
+	void SampleTarget(int32 Index);
+
+	/** Remove target at Index, swapping the last target into its place. */
+	void RemoveTargetAt(int32 Index);
+
+	/** Maps each registered target to its index in the arrays below. */
+	TMap<TObjectKey<AActor>, int32> TargetIndices;
+
+	TArray<TObjectKey<AActor>> TargetKeys;
+	TArray<TWeakObjectPtr<AActor>> Targets;
+	TArray<int32> RefCounts;
+	TArray<uint64> SampledFrames;
+	TArray<double> SampledTimes;
+	TArray<FVector> Positions;
+	TArray<FQuat> Rotations;
+	TArray<FVector> Velocities;
+	TArray<FVector> Accelerations;
+};
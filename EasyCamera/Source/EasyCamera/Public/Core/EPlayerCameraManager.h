@@ -48,6 +48,9 @@ public:
 protected:
 	virtual void DoUpdateCamera(float DeltaTime) override;
 
+	/** Gives ECamera view targets a chance to late-update their pose before it is read. */
+	virtual void UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime) override;
+
 public:
 	/** Applies a post process material to the player camera manager. 
 	 *  @param InBlendableObject - The post process material to add.
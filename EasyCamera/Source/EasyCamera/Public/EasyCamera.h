@@ -11,6 +11,10 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Stats/Stats.h"
+
+/** Stats of EasyCamera, shown by console command "stat EasyCamera". */
+DECLARE_STATS_GROUP(TEXT("EasyCamera"), STATGROUP_EasyCamera, STATCAT_Advanced);
 
 class FEasyCameraModule : public IModuleInterface
 {
@@ -5,8 +5,11 @@
 #include "CoreMinimal.h"
 #include "Extensions/ECameraExtensionBase.h"
 #include "Utils/ECameraTypes.h"
+#include "WorldCollision.h"
 #include "DeoccluderExtension.generated.h"
 
+class UCurveFloat;
+
 
 /**
  * DeoccluderExtension is used for camera occlusion detection along the direction from camera to aim target.
@@ -40,6 +43,38 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
 	float RestoreDamping;
 
+	/** If on, cast whisker rays from target towards frustum corners and sides of camera besides the sight line.
+	 *  Thin occluders at screen edges are then detected before they reach the sight line, and camera is pushed in preemptively.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bUseWhiskers;
+
+	/** Whether to cast a whisker towards each of the four corners of camera near plane. These are refreshed every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bUseWhiskers"))
+	bool bCornerWhiskers;
+
+	/** Distance of near plane in front of camera, towards whose corners corner whiskers are cast. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bUseWhiskers && bCornerWhiskers", ClampMin = "0.0"))
+	float CornerWhiskerDepth;
+
+	/** Number of feelers on each of left and right sides of the sight line. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bUseWhiskers", ClampMin = "0", ClampMax = "8"))
+	int32 NumSideWhiskers;
+
+	/** Angle in degrees between the sight line and the outermost side feeler, rotated around target about camera up axis. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bUseWhiskers", ClampMin = "0.0", ClampMax = "90.0"))
+	float SideWhiskerAngle;
+
+	/** Maximum number of side feelers traced per frame. Side feelers take turns, and the others keep their last results. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bUseWhiskers", ClampMin = "0"))
+	int32 SideWhiskerBudget;
+
+	/** A curve mapping the angle of a side feeler, normalized to [0, 1] by SideWhiskerAngle, to how much of its hit depth pushes camera in, within [0, 1].
+	 *  If not set, it falls from 1 next to the sight line to 0.5 at the outermost feeler. Corner whiskers always push in fully.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bUseWhiskers"))
+	UCurveFloat* WhiskerPushInCurve;
+
 	/** How long occlusion has lasted? */
 	float OcclusionElapsedTime;
 	/** Cached raw camera location. */
@@ -48,6 +83,45 @@ protected:
 	float DeltaDistanceFromCamera;
 	/** Already damped time. */
 	float AlreadyDampedTime;
+	/** Hits found by trace. Kept across ticks so that its memory is reused. */
+	TArray<FHitResult> HitResults;
+	/** Handle of the async trace submitted last frame. */
+	FTraceHandle PendingTraceHandle;
+	/** Start location of the async trace submitted last frame. */
+	FVector PendingTraceStart;
+	/** End location of the async trace submitted last frame. */
+	FVector PendingTraceEnd;
+	/** Whether the next trace must be synchronous, e.g., after camera becomes view target. */
+	bool bForceSyncTrace;
+	/** Hit fraction of each whisker along its ray, 1 if nothing is hit. Corner whiskers come first, then left and right feelers. */
+	TArray<float> WhiskerFractions;
+	/** Handles of whisker async traces submitted last frame. */
+	TArray<FTraceHandle> PendingWhiskerHandles;
+	/** Whisker indices of the async traces submitted last frame. */
+	TArray<int32> PendingWhiskerIndices;
+	/** Next side feeler to refresh, relative to the first side feeler. */
+	int32 NextSideWhisker;
+	/** Whether the last sight line trace was clear and is cached. */
+	bool bTraceCacheValid;
+	/** Start and end locations of the cached clear trace. */
+	FVector CachedTraceStart;
+	FVector CachedTraceEnd;
+	/** Shape and radius of the cached clear trace. */
+	ETraceShape CachedTraceShape;
+	float CachedTraceRadius;
+	/** World time at which the cached clear trace was made. */
+	double CachedTraceTime;
+	/** Movable primitives near the cached clear trace, with their transforms at that time. */
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> CachedMovers;
+	TArray<FTransform> CachedMoverTransforms;
+	/** Whether whiskers were traced when the cache was built, with the field of view they were traced with. */
+	bool bWhiskersInTraceCache;
+	float CachedWhiskerFieldOfView;
+	/** Fraction of the sight line camera is pushed in to by whiskers in the last update, reused while the cache is valid. */
+	float CachedWhiskerFraction;
+	/** Number of sight line and whisker traces requested and skipped by the cache, since camera became view target. */
+	int32 NumTraceQueries;
+	int32 NumTraceCacheHits;
 
 public:
 	virtual void UpdateComponent_Implementation(float DeltaTime) override;
@@ -55,6 +129,59 @@ public:
 	/** Reset camera location before tick begins for correct occlusion damping. */
 	virtual void BindToOnPreTickComponent() override;
 
+	/** Last frame's async result belongs to another camera state, so trace synchronously once. */
+	virtual void ResetOnBecomeViewTarget(APlayerController* PC, bool bPreserveState) override;
+
+	/** Trace synchronously from Start to End, writing hits to HitResults. */
+	void TraceSync(const FVector& Start, const FVector& End);
+
+	/** Submit an async trace from Start to End, whose result is consumed in the next frame. */
+	void SubmitAsyncTrace(const FVector& Start, const FVector& End);
+
+	/** Read hits of last frame's async trace into HitResults, moved onto the ray from Start to End. Returns false if a synchronous trace is needed. */
+	bool ConsumeAsyncTrace(const FVector& Start, const FVector& End);
+
+	/** Whether either end of the sight line has moved farther than AsyncFallbackDistance since last async trace was submitted. */
+	bool HasSightLineJumped(const FVector& Start, const FVector& End) const;
+
+	/** Whether the cached clear trace still holds for the sight line from Start to End. */
+	bool IsTraceCacheValid(const FVector& Start, const FVector& End) const;
+
+	/** Cache the clear trace just traced synchronously from Start to End, and watch movable primitives near it and its whiskers. Target and camera are not watched, as they are tracked by the two ends. */
+	void BuildTraceCache(const FVector& Start, const FVector& End, AActor* Target);
+
+	/** Drop the cached clear trace. */
+	void InvalidateTraceCache()
+	{
+		bTraceCacheValid = false;
+		CachedMovers.Reset();
+		CachedMoverTransforms.Reset();
+	}
+
+	/** Fraction of sight line and whisker traces skipped by the cache since camera became view target. */
+	UFUNCTION(BlueprintPure, Category = "ECamera|Deoccluder")
+	float GetTraceCacheHitRate() const { return NumTraceQueries > 0 ? float(NumTraceCacheHits) / NumTraceQueries : 0.0f; }
+
+	/** Whether the cached trace also stands for whiskers as currently laid out. Always true if whiskers are not used. */
+	bool AreWhiskersCached();
+
+	/** Number of whisker traces made in one update within budget. */
+	int32 GetNumRefreshedWhiskers() const;
+
+	/** Refresh whiskers within budget, and return the fraction of the sight line camera is pushed in to by all whiskers.
+	 *  If bAsync, whiskers submitted last frame are read and this frame's are submitted. If bDiscard, previous whisker results are dropped. If bRefreshAll, the budget is ignored.
+	 */
+	float UpdateWhiskers(const FVector& Start, const FVector& End, bool bAsync, bool bDiscard, bool bRefreshAll);
+
+	/** End location of the whisker at Index, whose ray starts from Start as the sight line does. */
+	FVector GetWhiskerEnd(int32 Index, const FVector& Start, const FVector& End);
+
+	/** How much of its hit depth the whisker at Index pushes camera in. */
+	float GetWhiskerPushInWeight(int32 Index) const;
+
+	/** Insert a virtual hit at Fraction of the sight line into HitResults, keeping them sorted by distance. */
+	void AddWhiskerHit(const FVector& Start, const FVector& End, float Fraction);
+
 	/** Reset variables and do restoring damping. */
 	void ResetVariablesAndRestoreDamping(float DeltaTime, const float& Input, float Damping, const FVector& Direction);
 
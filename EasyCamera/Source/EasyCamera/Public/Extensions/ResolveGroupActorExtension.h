@@ -4,8 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Extensions/ECameraExtensionBase.h"
+#include "Misc/MemStack.h"
 #include "ResolveGroupActorExtension.generated.h"
 
+class UECameraGroupActorComponent;
+
 /**
  * This extension will adjust camera FOV or (and) distance to encapsulate a bounding box formed by
  * the group actor, if any in follow component or aim component. This bounding box is the union of
@@ -58,8 +61,13 @@ public:
 	virtual void UpdateComponent_Implementation(float DeltaTime) override;
 
 	/** Resolve group actor in screen space according to ResolveMethod. */
-	void ResolveGroupActor(TArray<FBoundingWrappedActor> TargetActors, float DeltaTime);
-	/** Get required FOV that encapsulates target actors in front of camera. */
-	float GetFOVForZoomOnly(TArray<FBoundingWrappedActor> TargetActors, float DeltaTime);
-	float GetDistanceForDistanceOnly(TArray<FBoundingWrappedActor> TargetActors, float DeltaTime, const float& FOV);
+	void ResolveGroupActor(TArrayView<UECameraGroupActorComponent* const> Groups, float DeltaTime);
+	/** Transform target actors of all groups in front of camera into camera space once, storing the depth and the aspect-scaled half extent of each shape point.
+	 *  A screen box or a sphere yields one point, and a hull yields one for each corner. Returns the largest extent-to-depth ratio, from which the required FOV follows directly.
+	 */
+	double GatherTargetExtents(TArrayView<UECameraGroupActorComponent* const> Groups, TArray<double, TMemStackAllocator<>>& OutDepths, TArray<double, TMemStackAllocator<>>& OutExtents);
+	/** Get damped delta FOV that encapsulates target actors in front of camera, given their largest extent-to-depth ratio. */
+	float GetDeltaFOV(double MaxExtentRatio, float DeltaTime);
+	/** Get damped delta distance that encapsulates target actors in front of camera under FOV. */
+	float GetDeltaDistance(TArrayView<const double> Depths, TArrayView<const double> Extents, float FOV, float DeltaTime);
 };
@@ -0,0 +1,38 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "ECameraAimAssistTargetComponent.generated.h"
+
+/**
+ * Add this component to an actor to make it an aim assist candidate of ControlAim, regardless of the camera's aim assist TargetTypes.
+ * Registered candidates are stored in UECameraAimAssistSubsystem, so cameras never need to scan the world for them.
+ */
+UCLASS(Blueprintable, BlueprintType, classGroup = "ECamera", meta = (BlueprintSpawnableComponent))
+class EASYCAMERA_API UECameraAimAssistTargetComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UECameraAimAssistTargetComponent();
+
+protected:
+	/** Local space offset applied to owning actor's location. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ECamera|AimAssist")
+	FVector Offset;
+
+protected:
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+
+public:
+	/** Set local space offset. */
+	UFUNCTION(BlueprintCallable, Category = "ECamera|AimAssist")
+	void SetOffset(const FVector& InOffset);
+
+	/** Get local space offset. */
+	UFUNCTION(BlueprintPure, Category = "ECamera|AimAssist")
+	FVector GetOffset() const { return Offset; }
+};
@@ -5,8 +5,17 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Utils/ECameraTypes.h"
+#include "UObject/ObjectKey.h"
 #include "ECameraGroupActorComponent.generated.h"
 
+/** Cached local space bounds of a group member, with the signature of the components they were computed from. */
+struct FECameraGroupMemberBounds
+{
+	FBox LocalBounds;
+	int32 NumComponents;
+	float RootRadius;
+};
+
 UCLASS(Blueprintable, BlueprintType, classGroup = "ECamera")
 class EASYCAMERA_API UECameraGroupActorComponent : public UActorComponent
 {
@@ -52,7 +61,99 @@ public :
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ECamera|GroupActor", meta = (EditCondition = "GroupRotationMethod == EGroupRotationMethod::Specified && SpecifiedRotationActor == nullptr"))
 	FRotator SpecifiedRotation;
 
+	/** Whether to refine average rotation towards the exact quaternion mean (the principal eigenvector of summed outer products).
+	 *  Only needed if member rotations spread widely; the normalized sum is already accurate for moderate spreads.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ECamera|GroupActor", meta = (EditCondition = "GroupRotationMethod != EGroupRotationMethod::Specified"))
+	bool bRefineAverageRotation;
+
+	/** Members (and the anchor) moving less than this distance since they were last sampled are treated as still. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ECamera|GroupActor", meta = (ClampMin = "0.0"))
+	float MoveThreshold;
+
+	/** Whether to update group actor every tick even if no active camera follows or aims at it, e.g., when gameplay code reads its transform.
+	 *  Disable to let group actor stop ticking while idle. It then wakes up as soon as an active camera follows or aims at it, but its transform is stale until then.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ECamera|GroupActor")
+	bool bAlwaysUpdate;
+
+protected:
+	/** Member data sampled in the last refresh, parallel to TargetActors. Positions and rotations only change when a member moves beyond the threshold. */
+	TArray<TObjectKey<AActor>> MemberActors;
+	TArray<float> MemberWeights;
+	TArray<FVector> MemberPositions;
+	TArray<FQuat> MemberRotations;
+
+	/** Component bounds of members in their actors' local space, computed on first use and kept until the member leaves or its components change.
+	 *  Keyed by actor rather than index, so members added or swapped after this frame's refresh are still looked up correctly.
+	 */
+	TMap<TObjectKey<AActor>, FECameraGroupMemberBounds> MemberLocalBounds;
+
+	/** Relative change of root component's bounds radius beyond which member bounds are recomputed. Filters out small changes, e.g., of animated meshes. */
+	static constexpr float BoundsRadiusTolerance = 0.1f;
+
+	/** Aggregates accumulated over live members in the last refresh. */
+	int32 NumLiveMembers;
+	bool bAnyNonZeroWeight;
+	double WeightSum;
+	FVector PositionSum;
+	FVector WeightedPositionSum;
+	double DistanceWeightSum;
+	FVector DistancePositionSum;
+	double WeightedDistanceWeightSum;
+	FVector WeightedDistancePositionSum;
+	int32 ClosestIndex;
+	int32 FarestIndex;
+
+	/** Anchor location used in the last refresh. */
+	FVector RefreshedAnchorLocation;
+
+	/** Sums of member quaternions flipped into the hemisphere of the first live member, plain and weighted. */
+	FVector4 RotationSum;
+	FVector4 WeightedRotationSum;
+
+	/** Whether rotations were sampled and accumulated in the last refresh, and whether GetAverageRotation asked for them regardless of GroupRotationMethod. */
+	bool bRotationsSampled;
+	bool bRotationsRequested;
+	/** Whether rotation moments were accumulated in the last refresh. */
+	bool bMomentsAccumulated;
+
+	/** Upper triangles of the sums of quaternion outer products, plain and weighted. Only accumulated if bRefineAverageRotation is true. */
+	double RotationMoments[10];
+	double WeightedRotationMoments[10];
+
+	/** Transform last applied to the owner. */
+	FVector AppliedLocation;
+	FRotator AppliedRotation;
+
+	uint64 RefreshedFrame;
+	uint64 LastConsumedFrame;
+
 public:	
+	/** Called by an active camera each tick it follows or aims at this group. Wakes the owner up if it was idle. */
+	void MarkConsumed();
+
+	/** Whether any active camera consumed this group in current or last frame. */
+	bool IsConsumed() const;
+
+	/** Sample all members, and re-accumulate every aggregate used by group location and rotation methods if any member or the anchor changed. Returns whether anything changed. */
+	bool RefreshMembers();
+
+	/** Refresh members if not yet refreshed in current frame. */
+	void EnsureRefreshed();
+
+	/** Move owner to current group location and rotation. Owner's transform is only touched if they changed. */
+	void UpdateOwnerTransform();
+
+	/** Get component bounds of member Target, in its local space. Target must not be null.
+	 *  Bounds are cached, and recomputed when the member's number of components or root component's bounds radius changes.
+	 */
+	const FBox& GetMemberLocalBounds(const AActor* Target);
+
+	/** Recompute cached member bounds on next use. Only needed for changes the automatic check misses, e.g., a mesh swapped on a non-root component. */
+	UFUNCTION(BlueprintCallable, Category = "ECamera|GroupActor")
+	void RefreshMemberBounds();
+
 	/** Calculate group actor location according to GroupLocationMethod. */
 	UFUNCTION(BlueprintNativeEvent, BlueprintPure)
 	FVector GetGroupActorLocation();
@@ -67,7 +168,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "ECamera|GroupActor")
 	FVector GetAverageLocation(bool bIsArithmetic);
 
-	/** Calculate average rotation. If bIsArithemetic is true, this function will return arithmetic average. Otherwise it returns weighed average. Used for EGroupRotationMethod::ArithmeticAverage and EGroupRotationMethod::WeightedAverage. */
+	/** Calculate average rotation. If bIsArithemetic is true, this function will return arithmetic average. Otherwise it returns weighed average. Used for EGroupRotationMethod::ArithmeticAverage and EGroupRotationMethod::WeightedAverage.
+	 *  Quaternions are flipped into the hemisphere of the first live member and summed. The result does not depend on member order as long as all members lie within 90 degrees of each other.
+	 *  For wider spreads, the hemisphere reference changes the sum, unless bRefineAverageRotation is true.
+	 */
 	UFUNCTION(BlueprintPure, Category = "ECamera|GroupActor")
 	FRotator GetAverageRotation(bool bIsArithmetic);
 
@@ -138,6 +138,36 @@ public:
 	UFUNCTION(BlueprintPure, Category = "ECamera|Utils", meta = (DisplayName = "GetCameraLocalSpaceCoordinateWithVectors"))
 	static FVector GetLocalSpacePositionWithVectors(const FVector& PivotPosition, const FVector& ForwardVector, const FVector& RightVector, const FVector& UpVector, const FVector& InputPosition);
 
+	/** Get the offset from a target's current position to its predicted position.
+	 * @param Kinematics - Target kinematics.
+	 * @param PredictionParams - Prediction parameters.
+	 */
+	UFUNCTION(BlueprintPure, Category = "ECamera|Utils", meta = (DisplayName = "GetPredictedOffset"))
+	static FVector GetPredictedOffset(const FECameraTargetKinematics& Kinematics, const FPredictionParams& PredictionParams);
+
+	/** Build a camera frame (position and orthonormal basis) from an actor. Reuse it to transform many positions into the actor's local space.
+	 * @param Camera - Camera.
+	 */
+	UFUNCTION(BlueprintPure, Category = "ECamera|Utils", meta = (DisplayName = "MakeCameraFrame"))
+	static FECameraFrame MakeCameraFrame(const AActor* Camera);
+
+	/** Return the camera local space coordinate of an input world space position.
+	 * @param Frame - Cached camera frame.
+	 * @param InputPosition - World space input position.
+	 */
+	UFUNCTION(BlueprintPure, Category = "ECamera|Utils", meta = (DisplayName = "GetCameraLocalSpaceCoordinateWithFrame"))
+	static FVector GetLocalSpacePositionWithFrame(const FECameraFrame& Frame, const FVector& InputPosition);
+
+	/** Find the aim assist candidate closest to the view axis, among those in front of camera within MaxDistance.
+	 *  Candidate positions are passed as structure of arrays and scored several at a time. Ties resolve to the lowest index.
+	 *  Returns the candidate index, or INDEX_NONE if no candidate passes.
+	 * @param Frame - Cached camera frame.
+	 * @param PositionsX, PositionsY, PositionsZ - World space candidate positions, with offsets applied. Should have the same size.
+	 * @param MaxDistance - Candidates farther than this along camera forward are ignored.
+	 * @param OutScreenDistance - Distance from the returned candidate to the view axis.
+	 */
+	static int32 FindClosestAimAssistCandidate(const FECameraFrame& Frame, TArrayView<const double> PositionsX, TArrayView<const double> PositionsY, TArrayView<const double> PositionsZ, double MaxDistance, float& OutScreenDistance);
+
 
 	/** Call a TSubclassOf<ECameraBase> class type camera actor. If there exists one in the level, this node will use it. Otherwise it will instantiate a new one.
 	 *  Highly recommending using this node rather than UE's vanilla SetViewTargetWithBlend node.
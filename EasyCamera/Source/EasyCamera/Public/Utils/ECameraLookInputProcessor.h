@@ -0,0 +1,52 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Framework/Application/IInputProcessor.h"
+#include "Misc/MemStack.h"
+
+/** One raw look input sample, in Slate cursor units, stamped with a synthesized platform time. Slate events carry no timestamp of their own. */
+struct FECameraLookInputSample
+{
+	double Time;
+	FVector2D Delta;
+};
+
+/**
+ * Collects raw mouse move events between frames, so that look input can be integrated at sub-frame resolution.
+ * OS messages are pumped in a batch once per frame and mouse events carry no time, so samples received in one pump are spread evenly over the time since the previous pump.
+ * Order and relative size of samples within a frame are real, while their exact times are not.
+ * Samples are kept for a short while and never consumed, so any number of cameras can read them.
+ */
+class EASYCAMERA_API FECameraLookInputProcessor : public IInputProcessor
+{
+public:
+	/** Get the shared processor, registering it to Slate on first use. Returns null if Slate is not initialized. */
+	static TSharedPtr<FECameraLookInputProcessor> Get();
+
+	/** Unregister and release the shared processor. */
+	static void Shutdown();
+
+	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override;
+	virtual bool HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+
+	/** Get samples whose time lies in (StartTime, EndTime], in time order. */
+	void GetSamples(double StartTime, double EndTime, TArray<FECameraLookInputSample, TMemStackAllocator<>>& OutSamples);
+
+	/** Time of the latest pump, i.e., the time up to which samples are complete. */
+	double GetLatestTime();
+
+protected:
+	/** Stamp samples received since last pump, spreading them over the time since then. */
+	void StampPendingSamples();
+
+	/** How long samples are kept, in seconds. */
+	static constexpr double SampleLifetime = 0.5;
+
+	TArray<FECameraLookInputSample> Samples;
+	int32 NumPendingSamples = 0;
+	double LastPumpTime = 0.0;
+
+	static TSharedPtr<FECameraLookInputProcessor> Instance;
+};
@@ -0,0 +1,41 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SkeletalMeshComponent.h"
+
+/**
+ * Socket or bone of a target's skeletal mesh, resolved to a bone index once.
+ * Sampling then reads the mesh's cached component space bone transform, instead of searching sockets and bones by name every tick.
+ * Resolution is redone only when target, socket name, skeletal mesh component or its skinned asset changes.
+ */
+struct EASYCAMERA_API FECameraSocketCache
+{
+public:
+	FECameraSocketCache();
+
+	/** Resolve SocketName on Target's skeletal mesh if anything it depends on has changed. Returns whether a socket or bone is resolved. */
+	bool Update(const AActor* Target, FName SocketName);
+
+	/** Get world space transform of the resolved socket or bone. Only valid if Update returned true. */
+	FTransform GetTransform() const;
+
+	/** Forget the resolved socket. */
+	void Reset();
+
+protected:
+	/** Resolve socket or bone on current mesh. */
+	void Resolve();
+
+	TWeakObjectPtr<const AActor> ResolvedTarget;
+	TWeakObjectPtr<const USkeletalMeshComponent> MeshComponent;
+	TWeakObjectPtr<const UObject> SkinnedAsset;
+	FName ResolvedSocketName;
+
+	/** Bone the socket is attached to, or the bone itself. INDEX_NONE if nothing is resolved. */
+	int32 BoneIndex;
+
+	/** Socket's transform relative to its bone. Identity for bones. */
+	FTransform SocketLocalTransform;
+};
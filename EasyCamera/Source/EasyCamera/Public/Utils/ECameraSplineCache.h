@@ -0,0 +1,72 @@
+// Copyright 2023 by Sulley. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SplineComponent.h"
+
+/**
+ * Spline location and rotation baked at evenly spaced distances along a spline, in the spline component's local space.
+ * Evaluating at a fraction of spline length is then a constant time lookup, instead of a search in the spline's reparam table.
+ * Samples are rebuilt only when the spline's curves change, and stay valid when the spline component moves.
+ * Segments between samples are also organized in a bounding volume hierarchy, for fast closest point queries.
+ */
+struct EASYCAMERA_API FECameraSplineCache
+{
+public:
+	FECameraSplineCache();
+
+	/** Rebuild samples if Spline differs from the baked one or has been modified since. Returns whether samples are valid. */
+	bool Update(const USplineComponent* Spline);
+
+	/** Get world space transform at a fraction of spline length, in [0,1]. Scale is not included. */
+	FTransform GetTransformAtFraction(float Fraction) const;
+
+	/** Find fraction of spline length closest to a world space location.
+	 *  If WarmStartFraction is in [0,1], segments around it are tried first, so that a coherent query only visits a couple of segments.
+	 *  The result is exact for the baked polyline regardless of warm start, which only affects speed.
+	 */
+	float FindFractionClosestToWorldLocation(const FVector& WorldLocation, float WarmStartFraction = -1.0f) const;
+
+	/** Get spline length when samples were baked. */
+	float GetLength() const { return Length; }
+
+	/** Get number of baked samples. */
+	int32 GetNumSamples() const { return Locations.Num(); }
+
+	/** Approximate distance between adjacent samples. Smaller values are more accurate but take longer to bake. */
+	float SampleSpacing;
+
+	/** Maximum number of samples, bounding memory for very long splines. */
+	int32 MaxSamples;
+
+protected:
+	/** Get sample index and interpolation alpha at a fraction of spline length. */
+	void GetSampleAtFraction(float Fraction, int32& OutIndex, float& OutAlpha) const;
+
+	/** Build hierarchy node over segments [First, First + Count), returning its index. */
+	int32 BuildNode(int32 First, int32 Count);
+
+	/** Test segment against local space Location, updating closest segment if it is closer. */
+	void TestSegment(int32 Segment, const FVector& Location, double& BestDistSquared, int32& BestSegment, float& BestAlpha) const;
+
+	/** Node of the segment bounding volume hierarchy. Leaves have no children. */
+	struct FSegmentNode
+	{
+		FBox Bounds;
+		int32 First;
+		int32 Count;
+		int32 Children[2];
+	};
+
+	/** Maximum number of segments in a leaf. */
+	static constexpr int32 MaxLeafSegments = 4;
+
+	TWeakObjectPtr<const USplineComponent> BakedSpline;
+	uint32 BakedVersion;
+	float Length;
+
+	TArray<FVector> Locations;
+	TArray<FQuat> Rotations;
+	TArray<FSegmentNode> Nodes;
+};
@@ -151,6 +151,21 @@ enum class EResolveGroupActorMethod : uint8
 	Mix
 };
 
+/**
+* Shapes used to represent a target actor when resolving group actor in screen space.
+* Component bounds behind Sphere and Hull are cached by the group, and recomputed automatically when the actor's number of components or root component's bounds radius changes.
+*/
+UENUM()
+enum class EBoundingShape : uint8
+{
+	/** A box of Width and Height around target's pivot. */
+	ScreenBox,
+	/** A sphere enclosing target's component bounds. Cheapest shape that follows target's real size. */
+	Sphere,
+	/** Corners of target's component bounds box, oriented with target. Tightest fit for elongated targets. */
+	Hull
+};
+
 /** Methods you want to use for RailFollow component. */
 UENUM()
 enum class ERailFollowType : uint8
@@ -320,6 +335,30 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (EditCondition = "TraceShape == ETraceShape::Sphere", ClampMin = "0.01"))
 	float SphereRadius;
 
+	/** If on, trace is submitted asynchronously and its result is consumed in the next frame, which takes trace cost off game thread.
+	 *  Hits of last frame are moved onto the current sight line to compensate for the one frame latency.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bAsyncTrace;
+
+	/** If the sight line has moved farther than this since last frame, e.g., on camera cuts or teleports, trace synchronously instead. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (EditCondition = "bAsyncTrace", ClampMin = "0.0"))
+	float AsyncFallbackDistance;
+
+	/** If on, a clear trace is reused while both ends of the sight line stay within TraceCacheTolerance and no movable primitive near it has moved.
+	 *  In static scenes or cutscenes most traces are then skipped.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bCacheClearTrace;
+
+	/** How far either end of the sight line can move before a cached clear trace is traced again. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (EditCondition = "bCacheClearTrace", ClampMin = "0.0"))
+	float TraceCacheTolerance;
+
+	/** Maximum time in seconds a clear trace is reused. This bounds how late an occluder moving in from outside the watched region is detected. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (EditCondition = "bCacheClearTrace", ClampMin = "0.0"))
+	float TraceCacheMaxAge;
+
 	/** Whether to show debug line. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	bool bShowDebug;
@@ -330,6 +369,11 @@ public:
 		, MaximumTraceLength(0.0f)
 		, MinimumOcclusionTime(0.0f)
 		, SphereRadius(0.01f)
+		, bAsyncTrace(false)
+		, AsyncFallbackDistance(100.0f)
+		, bCacheClearTrace(false)
+		, TraceCacheTolerance(1.0f)
+		, TraceCacheMaxAge(0.5f)
 		, bShowDebug(false)
 	{ }
 };
@@ -391,6 +435,37 @@ public:
 	{ }
 };
 
+/** A set of parameters describing how to predict the future position of a target. */
+USTRUCT(BlueprintType)
+struct FPredictionParams
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/** Whether to extrapolate target position using its estimated velocity and acceleration. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bEnablePrediction;
+
+	/** How far ahead, in seconds, to predict. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bEnablePrediction", ClampMin = "0.0", ClampMax = "2.0"))
+	float Horizon;
+
+	/** Whether to take acceleration into account. Prediction stops where velocity would reverse its direction. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bEnablePrediction"))
+	bool bUseAcceleration;
+
+	/** Maximum distance the predicted position may be away from current position. Set as 0 to remove this limit. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "bEnablePrediction", ClampMin = "0.0"))
+	float MaxDistance;
+
+	FPredictionParams()
+		: bEnablePrediction(false)
+		, Horizon(0.2f)
+		, bUseAcceleration(true)
+		, MaxDistance(0.0f)
+	{ }
+};
+
 /** A set of parameters describing an actor wrapped by a bounding box. */
 USTRUCT(BlueprintType)
 struct FBoundingWrappedActor
@@ -406,12 +481,16 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
 	float Weight;
 
+	/** Shape representing this actor in screen space. Sphere and Hull are derived from the actor's component bounds, and ignore Width and Height. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EBoundingShape Shape;
+
 	/** (Half) Width of the bounding box on screen space. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0", EditCondition = "Shape == EBoundingShape::ScreenBox"))
 	float Width;
 
 	/** (Half) Height of the bounding box on screen space. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.0", EditCondition = "Shape == EBoundingShape::ScreenBox"))
 	float Height;
 
 	/** Whether to exclude this actor (ignore this bounding box) during the resolving stage. */
@@ -420,6 +499,7 @@ public:
 
 	FBoundingWrappedActor()
 		: Weight(1.0f)
+		, Shape(EBoundingShape::ScreenBox)
 		, Width(0.0f)
 		, Height(0.0f)
 		, bExcludeBoundingBox(false)
@@ -747,6 +827,106 @@ public:
 	{ }
 }; 
 
+/** Position and orthonormal basis of a camera, cached once so that world space positions can be cheaply transformed into camera local space. */
+USTRUCT(BlueprintType)
+struct FECameraFrame
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/** Camera world space position. */
+	UPROPERTY(BlueprintReadOnly)
+	FVector Position;
+
+	/** Camera forward vector, i.e., local space X axis. */
+	UPROPERTY(BlueprintReadOnly)
+	FVector Forward;
+
+	/** Camera right vector, i.e., local space Y axis. */
+	UPROPERTY(BlueprintReadOnly)
+	FVector Right;
+
+	/** Camera up vector, i.e., local space Z axis. */
+	UPROPERTY(BlueprintReadOnly)
+	FVector Up;
+
+	FECameraFrame()
+		: Position(FVector::ZeroVector)
+		, Forward(FVector::ForwardVector)
+		, Right(FVector::RightVector)
+		, Up(FVector::UpVector)
+	{ }
+
+	FECameraFrame(const FVector& InPosition, const FQuat& InRotation)
+	{
+		Set(InPosition, InRotation);
+	}
+
+	/** Rebuild the frame. The rotation is converted to a matrix only once. */
+	void Set(const FVector& InPosition, const FQuat& InRotation)
+	{
+		const FQuatRotationMatrix RotationMatrix(InRotation);
+		Position = InPosition;
+		Forward = RotationMatrix.GetScaledAxis(EAxis::X);
+		Right = RotationMatrix.GetScaledAxis(EAxis::Y);
+		Up = RotationMatrix.GetScaledAxis(EAxis::Z);
+	}
+
+	/** Transform a world space position into camera local space. */
+	FORCEINLINE FVector ToLocal(const FVector& WorldPosition) const
+	{
+		const FVector Diff = WorldPosition - Position;
+		return FVector(Diff | Forward, Diff | Right, Diff | Up);
+	}
+
+	/** Transform a camera local space position into world space. */
+	FORCEINLINE FVector ToWorld(const FVector& LocalPosition) const
+	{
+		return Position + Forward * LocalPosition.X + Right * LocalPosition.Y + Up * LocalPosition.Z;
+	}
+
+	/** Transform a batch of world space positions into camera local space. Both views should have the same size. */
+	void ToLocal(TArrayView<const FVector> WorldPositions, TArrayView<FVector> OutLocalPositions) const
+	{
+		check(WorldPositions.Num() == OutLocalPositions.Num());
+		for (int32 Index = 0; Index < WorldPositions.Num(); ++Index)
+		{
+			OutLocalPositions[Index] = ToLocal(WorldPositions[Index]);
+		}
+	}
+};
+
+/** Kinematic state of a camera target sampled in one frame. */
+USTRUCT(BlueprintType)
+struct FECameraTargetKinematics
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	/** World space position. */
+	UPROPERTY(BlueprintReadOnly)
+	FVector Position;
+
+	/** World space rotation. */
+	UPROPERTY(BlueprintReadOnly)
+	FQuat Rotation;
+
+	/** Filtered world space velocity. */
+	UPROPERTY(BlueprintReadOnly)
+	FVector Velocity;
+
+	/** Filtered world space acceleration. */
+	UPROPERTY(BlueprintReadOnly)
+	FVector Acceleration;
+
+	FECameraTargetKinematics()
+		: Position(FVector::ZeroVector)
+		, Rotation(FQuat::Identity)
+		, Velocity(FVector::ZeroVector)
+		, Acceleration(FVector::ZeroVector)
+	{ }
+};
+
 USTRUCT(BlueprintType)
 struct FPCMGRangeParams
 {